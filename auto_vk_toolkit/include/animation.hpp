@@ -160,6 +160,19 @@ namespace avk
 
 	};
 
+	/** Classification of an animated node's key collections w.r.t. one animation clip, see animation::classify_nodes */
+	enum struct node_animation_class
+	{
+		/** The local transform does not change during the clip. It is stored in animated_node::mStaticLocalTransform. */
+		constant,
+
+		/** Only the translation changes during the clip. The constant rotation and scaling are stored in animated_node::mStaticLocalTransform. */
+		translation_only,
+
+		/** Translation, rotation, or scaling change during the clip (or the node has not been classified). */
+		full,
+	};
+
 	/**	Struct containing data about one specific animated node.
 	 *	Class animation will contain multiple of such in most cases.
 	 */
@@ -186,8 +199,29 @@ namespace avk
 		 */
 		bool mSameScalingAndPositionKeyTimes;
 
+		/** If set, the keys of every key collection of this node which contains more than one key are evenly
+		 *	spaced at this interval (in ticks), starting at the time of the collection's first key. This allows
+		 *	to compute key indices directly instead of searching for them. See animation::resample_keys_uniformly.
+		 */
+		std::optional<double> mUniformKeyInterval;
+
 		/** The local transform of this node */
 		glm::mat4 mLocalTransform;
+
+		/** How this node's local transform changes during the clip which the nodes have been classified for,
+		 *	see animation::classify_nodes. Nodes which have not been classified are evaluated fully.
+		 */
+		node_animation_class mAnimationClass = node_animation_class::full;
+
+		/** For constant nodes: the local transform. For translation-only nodes: the local transform without translation.
+		 *	Only valid if mAnimationClass is not node_animation_class::full.
+		 */
+		glm::mat4 mStaticLocalTransform{ 1.0f };
+
+		/** True if this node and all of its animated parents are constant during the classified clip. Then, mGlobalTransform
+		 *	has been precomputed by animation::classify_nodes and is not updated during animation::animate anymore.
+		 */
+		bool mConstantGlobalTransform = false;
 		
 		/** The global transform of this node */
 		glm::mat4 mGlobalTransform;
@@ -219,6 +253,18 @@ namespace avk
 		std::vector<bone_mesh_data> mBoneMeshTargets;
 	};
 
+	/**	Positions of the keys which have been found by the most recent key lookups of one animated_node.
+	 *	Lookups which are given the cursors start there, which makes them O(1) while the animation time advances monotonically.
+	 *	The cursors are owned by the caller (see animation::create_key_cursors), s.t. the same animation can be evaluated
+	 *	concurrently with different cursors. They are mere hints, i.e. stale cursors are valid, too.
+	 */
+	struct animated_node_key_cursors
+	{
+		size_t mPositionKey = 0;
+		size_t mRotationKey = 0;
+		size_t mScalingKey = 0;
+	};
+
 	/** Represents possible spaces which the final bone matrices can be transformed into. */
 	enum struct bone_matrices_space
 	{
@@ -228,7 +274,28 @@ namespace avk
 		/** Model space is the space of a model (within which meshes are positioned). */
 		model_space,
 	};
-	
+
+	/**	Converts a bone matrix into the compact 3x4 format (48 bytes instead of 64 bytes), which omits the bone matrix'
+	 *	last row (0, 0, 0, 1): Column i of the result contains row i of the bone matrix. This is the same convention
+	 *	which glm::mat3x4_cast uses. In GLSL, a position p is transformed with vec4(p, 1.0) * boneMatrix3x4.
+	 *	@param	aBoneMatrix		The affine bone matrix
+	 */
+	glm::mat3x4 to_bone_matrix_3x4(const glm::mat4& aBoneMatrix);
+
+	/**	Converts a bone matrix into a unit dual quaternion (32 bytes instead of 64 bytes), which can be blended in a
+	 *	skinning shader with dual quaternion linear blending. It represents only the rotation and translation of the bone
+	 *	matrix, i.e. scaling and shearing are lost, which makes it suitable for rigid skeletons only.
+	 *	A negative determinant is attributed to a mirroring along x, which is lost as well.
+	 *	If the bone matrix' axes are not orthonormal (within a tolerance of 1e-3), a warning is logged (once per run).
+	 *	@param	aBoneMatrix		The affine bone matrix
+	 */
+	glm::dualquat to_bone_dual_quaternion(const glm::mat4& aBoneMatrix);
+
+	/**	Converts a dual quaternion back into a bone matrix. The dual quaternion does not have to be normalized.
+	 *	@param	aBoneDualQuaternion		The dual quaternion, e.g. one which has been created with to_bone_dual_quaternion
+	 */
+	glm::mat4 to_bone_matrix(const glm::dualquat& aBoneDualQuaternion);
+
 	class model_t;
 
 	/**	Class that represents one specific animation for one or multiple meshes
@@ -236,6 +303,7 @@ namespace avk
 	class animation
 	{
 		friend class model_t;
+		friend class packed_animation;
 		
 	public:
 		/**	Calculates the bone animation, calculates and writes all the bone matrices into their target storage.
@@ -261,6 +329,9 @@ namespace avk
 		 *								- size_t aBoneMeshTargetIndex:             (optional)  Contains the index into animated_node::mBoneMeshTargets that is the current one at the point in time when this callback is invoked.
 		 *								- double aAnimationTimeInTicks:            (optional)  Contains the animation time in ticks, at the point in time when this callback is invoked.
 		 *								
+		 *	Key lookups start at the keys which have been found by the previous call, using key cursors which are stored in this animation.
+		 *	Use the overload which takes animated_node_key_cursors to manage them yourself.
+		 *
 		 *	@example [storagePointer](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
 		 *	    // You'll need to ^ capture some pointer or data structure to write into the target location.
 		 *		assert (aInfo.mBoneMatrixTargetIndex.has_value());
@@ -271,6 +342,24 @@ namespace avk
 		template <typename F>
 		void animate(const animation_clip_data& aClip, double aTime, F&& aBoneMatrixCalc)
 		{
+			if (mKeyCursors.size() != mAnimationData.size()) {
+				mKeyCursors = create_key_cursors();
+			}
+			animate(aClip, aTime, std::forward<F>(aBoneMatrixCalc), mKeyCursors);
+		}
+
+		/**	Same as the animate overload above, but the key lookups use the given cursors instead of the ones of this animation.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aBoneMatrixCalc		Callback-function that receives the matrices which are relevant for computing the final bone matrix, see above
+		 *	@param	aKeyCursors			One entry per animated node, which must have been created by create_key_cursors of this animation
+		 */
+		template <typename F>
+		void animate(const animation_clip_data& aClip, double aTime, F&& aBoneMatrixCalc, std::vector<animated_node_key_cursors>& aKeyCursors)
+		{
+			if (aKeyCursors.size() != mAnimationData.size()) {
+				throw avk::logic_error("The key cursors have not been created for this animation.");
+			}
 			if (aClip.mTicksPerSecond == 0.0) {
 				throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
 			}
@@ -278,6 +367,10 @@ namespace avk
 				throw avk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
 			}
 
+			if (mClassifiedTickRange.has_value() && mClassifiedTickRange.value() != std::make_tuple(aClip.mStartTicks, aClip.mEndTicks)) {
+				throw avk::runtime_error("The nodes of this animation have been classified for a different clip. Classify them for the passed clip or reset their classification.");
+			}
+
 			double timeInTicks = aTime * aClip.mTicksPerSecond;
 
 			const auto an = mAnimationData.size();
@@ -285,14 +378,17 @@ namespace avk
 				auto& anode = mAnimationData[ai];
 
 				// Get the node-local TRS transformation matrix:
-				auto localTransform = compute_node_local_transform(anode, timeInTicks);
+				auto localTransform = compute_node_local_transform(anode, timeInTicks, &aKeyCursors[ai]);
 
-				// Calculate the node's global transform, using its local transform and the transforms of its parents:
-				if (anode.mAnimatedParentIndex.has_value()) {
-					anode.mGlobalTransform = mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform * anode.mParentTransform * localTransform;
-				}
-				else {
-					anode.mGlobalTransform = anode.mParentTransform * localTransform;
+				// Calculate the node's global transform, using its local transform and the transforms of its parents.
+				// (The global transforms of constant subtrees have been precomputed by classify_nodes.)
+				if (!anode.mConstantGlobalTransform) {
+					if (anode.mAnimatedParentIndex.has_value()) {
+						anode.mGlobalTransform = mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform * anode.mParentTransform * localTransform;
+					}
+					else {
+						anode.mGlobalTransform = anode.mParentTransform * localTransform;
+					}
 				}
 
 				// Calculate the final bone matrices for this node, for each mesh that is affected; and write out the matrix into the target storage:
@@ -335,36 +431,40 @@ namespace avk
 		/**	Computes the node-local translation at the given animation time (in ticks).
 		 *	@param	aNode				Node to compute the local translation for
 		 *	@param	aTimeInTicks		Animation time that determines the state of the node-local animation matrix
+		 *	@param	aKeyCursors			If given, the key lookups start at these cursors and update them. Otherwise, they use binary search.
 		 *	@return	Translation according to the parameters. In case there are no animation keys specified
 		 *			for the node, the returned value will just be the translation part of aNode.mLocalTransform.
 		 */
-		glm::vec3 compute_node_local_translation(const animated_node& aNode, double aTimeInTicks) const;
+		glm::vec3 compute_node_local_translation(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors = nullptr) const;
 		
 		/**	Computes the node-local rotation at the given animation time (in ticks).
 		 *	@param	aNode				Node to compute the local rotation for
 		 *	@param	aTimeInTicks		Animation time that determines the state of the node-local animation matrix
+		 *	@param	aKeyCursors			If given, the key lookups start at these cursors and update them. Otherwise, they use binary search.
 		 *	@return	Rotation according to the parameters. In case there are no animation keys specified
 		 *			for the node, the returned value will just be the rotation part of aNode.mLocalTransform.
 		 */
-		glm::quat compute_node_local_rotation(const animated_node& aNode, double aTimeInTicks) const;
+		glm::quat compute_node_local_rotation(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors = nullptr) const;
 
 		/**	Computes the node-local scale at the given animation time (in ticks).
 		 *	@param	aNode				Node to compute the local scale for
 		 *	@param	aTimeInTicks		Animation time that determines the state of the node-local animation matrix
+		 *	@param	aKeyCursors			If given, the key lookups start at these cursors and update them. Otherwise, they use binary search.
 		 *	@return	Scale according to the parameters. In case there are no animation keys specified
 		 *			for the node, the returned value will just be the scale part of aNode.mLocalTransform.
 		 */
-		glm::vec3 compute_node_local_scale (const animated_node& aNode, double aTimeInTicks) const;
+		glm::vec3 compute_node_local_scale (const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors = nullptr) const;
 		
 		/**	Computes the node-local transformation matrix at the given animation time (in ticks).
 		 *	I.e. disregards any other node (e.g. parents) and only computes the transformation of the
 		 *	node passed.
 		 *	@param	aNode				Node to compute the local transformation matrix for
 		 *	@param	aTimeInTicks		Animation time that determines the state of the node-local animation matrix
+		 *	@param	aKeyCursors			If given, the key lookups start at these cursors and update them. Otherwise, they use binary search.
 		 *	@return	Transformation matrix according to the parameters. In case there are no animation keys specified
 		 *			for the node, the returned matrix will just be the same as aNode.mLocalTransform.
 		 */
-		glm::mat4 compute_node_local_transform(const animated_node& aNode, double aTimeInTicks) const;
+		glm::mat4 compute_node_local_transform(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors = nullptr) const;
 
 		/**	Computes the node-local translation at the given animation time (in ticks).
 		 *	@param	aNode				Node to compute the local translation for
@@ -456,6 +556,97 @@ namespace avk
 		 */
 		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
 
+		/** Same as the glm::mat4 overload, but writes the bone matrices in the compact 3x4 format, see to_bone_matrix_3x4.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@param	aMeshStride			Offset in BYTES between the first memory target location for mesh i, and the first memory target location for mesh i+1
+		 *	@param	aMatricesStride		Offset in BYTES between two consecutive bone matrices that are assigned to the same mesh. By default, it will be set to sizeof(glm::mat3x4)
+		 *	@param	aMaxMeshes			The maximum number of meshes to write out bone matrices for. That means, always the first #aMaxMeshes meshes w.r.t. mesh_bone_info::mMeshAnimationIndex will be written.
+		 *	@param	aMaxBonesPerMesh	The maximum number of bones to write out bone matrices for per mesh. Only the first #aMaxBonesPerMesh bone matrices w.r.t. mesh_bone_info::mMeshLocalBoneIndex will be written.
+		 */
+		void animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/** Same as the glm::mat4 overload, but writes the bone transforms as dual quaternions, see to_bone_dual_quaternion.
+		 *	Attention: Dual quaternions can only represent rotations and translations. Use them for rigid skeletons only.
+		 *	Bone transforms which contain scaling, mirroring, or shearing are deformed incorrectly, and a warning is logged.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by the bone transforms
+		 *	@param	aTargetMemory		Pointer to the memory location where the first dual quaternion shall be written to
+		 *	@param	aMeshStride			Offset in BYTES between the first memory target location for mesh i, and the first memory target location for mesh i+1
+		 *	@param	aMatricesStride		Offset in BYTES between two consecutive dual quaternions that are assigned to the same mesh. By default, it will be set to sizeof(glm::dualquat)
+		 *	@param	aMaxMeshes			The maximum number of meshes to write out dual quaternions for. That means, always the first #aMaxMeshes meshes w.r.t. mesh_bone_info::mMeshAnimationIndex will be written.
+		 *	@param	aMaxBonesPerMesh	The maximum number of bones to write out dual quaternions for per mesh. Only the first #aMaxBonesPerMesh dual quaternions w.r.t. mesh_bone_info::mMeshLocalBoneIndex will be written.
+		 */
+		void animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/**	Same as the glm::mat4 overload, but writes the bone matrices in the compact 3x4 format, see to_bone_matrix_3x4.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory);
+
+		/**	Same as the glm::mat4 overload, but writes the bone transforms as dual quaternions, see to_bone_dual_quaternion.
+		 *	Attention: Dual quaternions can only represent rotations and translations. Use them for rigid skeletons only.
+		 *	Bone transforms which contain scaling, mirroring, or shearing are deformed incorrectly, and a warning is logged.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by the bone transforms
+		 *	@param	aTargetMemory		Pointer to the memory location where the first dual quaternion shall be written to
+		 */
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory);
+
+		/**	Resamples the animation keys of all nodes s.t. they are evenly spaced in time, which allows to
+		 *	find the keys for a given point in time by direct indexing instead of searching.
+		 *	Collections which contain only one key are left as they are. All other key collections of a node
+		 *	are resampled across the same time range, which is the range spanned by all of them, so that they
+		 *	share their key times. Values between the original keys are interpolated like during animation,
+		 *	i.e. resampling at an interval which does not hit all original key times will smooth the animation.
+		 *	@param	aKeyIntervalInTicks	The time between two consecutive keys after resampling, in ticks. Must be greater than 0.
+		 */
+		void resample_keys_uniformly(double aKeyIntervalInTicks);
+
+		/**	Removes all animation keys which can be reconstructed by interpolating between their neighboring keys
+		 *	within the given tolerances. Interpolation is performed like during animation, i.e. with lerp for
+		 *	translations and scalings, and with slerp for rotations.
+		 *	A key collection whose keys are all within the tolerance of its first key is reduced to that single key.
+		 *	If this applies to all key collections of a node, the node's keys are removed entirely, and their
+		 *	constant transform is stored in mLocalTransform instead.
+		 *	The reduced keys are generally not evenly spaced anymore, i.e. mUniformKeyInterval is reset.
+		 *	@param	aMaxTranslationError	The maximum distance between an original translation key and its reconstruction
+		 *	@param	aMaxRotationError		The maximum angle (in radians) between an original rotation key and its reconstruction
+		 *	@param	aMaxScalingError		The maximum distance between an original scaling key and its reconstruction
+		 */
+		void reduce_keys(float aMaxTranslationError = 1e-4f, float aMaxRotationError = 1e-4f, float aMaxScalingError = 1e-4f);
+
+		/**	Classifies all nodes w.r.t. the given clip as constant, translation-only, or full, depending on which of their
+		 *	key collections change within the clip's time range, and speeds up animate accordingly: The local transforms of
+		 *	constant nodes are not interpolated anymore, the rotations and scalings of translation-only nodes neither, and
+		 *	the global transforms of constant subtrees (i.e. constant nodes with constant animated parents) are precomputed
+		 *	once. This includes nodes without keys, and the filler keys which prepare_animation inserts into empty key collections.
+		 *	Afterwards, animate may only be invoked with the given clip and with times within its range. packed_animation
+		 *	folds constant nodes into their parent transforms, i.e. it is also limited to the clip if created afterwards.
+		 *	Invoke this after any modifications of the keys, e.g. by reduce_keys or resample_keys_uniformly.
+		 *	@param	aClip					The clip which the animation will be played with
+		 *	@param	aMaxTranslationError	The maximum distance between translation keys which are considered equal
+		 *	@param	aMaxRotationError		The maximum angle (in radians) between rotation keys which are considered equal
+		 *	@param	aMaxScalingError		The maximum distance between scaling keys which are considered equal
+		 */
+		void classify_nodes(const animation_clip_data& aClip, float aMaxTranslationError = 0.0f, float aMaxRotationError = 0.0f, float aMaxScalingError = 0.0f);
+
+		/**	Resets the classification of all nodes which has been established by classify_nodes, s.t. the animation can be
+		 *	played with any clip again.
+		 */
+		void reset_node_classification();
+
 		/**	Returns all the unique keyframe time-values of the given animation.
 		 *	@param	aClip				Animation clip which to extract the unique keyframe time-values from
 		 *	@return	A collection of unique keyframe times in ticks
@@ -464,6 +655,11 @@ namespace avk
 
 		/** Returns the total number of animated nodes stored in an animation */
 		size_t number_of_animated_nodes() const;
+
+		/**	Creates key cursors for all animated nodes of this animation, which can be passed to animate.
+		 *	Each thread which evaluates this animation concurrently with others needs its own key cursors.
+		 */
+		std::vector<animated_node_key_cursors> create_key_cursors() const { return std::vector<animated_node_key_cursors>(mAnimationData.size()); }
 		
 		/** Returns the animated_node data structure at the given index
 		 *	@param	aNodeIndex			Index referring to the node that shall be returned
@@ -524,25 +720,58 @@ namespace avk
 		auto get_animated_nodes() const { return mAnimationData; }
 
 	private:
+		/** Number of keys which find_positions_in_keys steps forward from a cursor before it falls back to binary search */
+		static constexpr size_t sMaxLinearKeySteps = 4;
+
 		/** Helper function used during animate() to find two positions of key-elements
 		 *	between which the given aTime lies.
+		 *	@param	aCollection			The keys, sorted by time
+		 *	@param	aTime				The time to find the keys for
+		 *	@param	aUniformKeyInterval	If set, the keys are evenly spaced at this interval and their positions are computed directly.
+		 *	@param	aCursor				If given: Position which has been found by the previous lookup in aCollection. The search starts
+		 *								there and only steps forward a few keys if aTime has advanced; larger jumps in either direction
+		 *								(e.g. seeking or looping) are handled by binary search. Receives the new position.
+		 *								If not given, the position is found by binary search in the whole collection.
 		 */
 		template <typename T>
-		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime) const
+		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime, std::optional<double> aUniformKeyInterval, size_t* aCursor) const
 		{
 			const auto maxIndex = aCollection.size() - 1;
-			
-			size_t pos1 = 0;
-			while (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
-				++pos1;
+			// Position of the last key at or before aTime within [aFirst, aLast), or aFirst if there is none:
+			const auto binarySearch = [&aCollection, aTime](size_t aFirst, size_t aLast) {
+				auto it = std::upper_bound(aCollection.begin() + aFirst, aCollection.begin() + aLast, aTime, [](double aTime, const auto& aKey) { return aTime < aKey.mTime; });
+				return it == aCollection.begin() + aFirst ? aFirst : static_cast<size_t>(std::distance(aCollection.begin(), it)) - 1;
+			};
+
+			size_t pos1;
+			if (aUniformKeyInterval.has_value() && maxIndex > 0) {
+				const auto steps = std::floor((aTime - aCollection[0].mTime) / aUniformKeyInterval.value());
+				pos1 = steps <= 0.0 ? 0 : std::min(static_cast<size_t>(steps), maxIndex);
 			}
-			
-			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
-			while (pos2 + 1 < maxIndex && aCollection[pos2 + 1].mTime < aTime) {
-				LOG_WARNING(fmt::format("Now that's strange: keys[{}].mTime {} < {}, despite keys[{}].mTime {} <= {}", pos2 + 1, aCollection[pos2 + 1].mTime, aTime, pos1, aCollection[pos1].mTime, aTime));
-				++pos2;
+			else if (nullptr == aCursor) {
+				pos1 = binarySearch(0, aCollection.size());
 			}
-			
+			else {
+				pos1 = std::min(*aCursor, maxIndex);
+				if (aCollection[pos1].mTime <= aTime) {
+					// Time has advanced (or stayed the same), which is the common case during playback:
+					for (size_t step = 0; step < sMaxLinearKeySteps && pos1 < maxIndex && aCollection[pos1 + 1].mTime <= aTime; ++step) {
+						++pos1;
+					}
+					if (pos1 < maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
+						pos1 = binarySearch(pos1 + 1, aCollection.size());
+					}
+				}
+				else {
+					// Time has gone backwards:
+					pos1 = binarySearch(0, pos1);
+				}
+			}
+
+			if (nullptr != aCursor) {
+				*aCursor = pos1;
+			}
+			const size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
 			return std::make_tuple(pos1, pos2);
 		}
 
@@ -574,6 +803,12 @@ namespace avk
 		 */
 		size_t mMaxNumBoneMatrices;
 
+		/** The start and end ticks of the clip which the nodes have been classified for, see classify_nodes */
+		std::optional<std::tuple<double, double>> mClassifiedTickRange;
+
+		/** The key cursors which are used by the animate overload that is not given any */
+		std::vector<animated_node_key_cursors> mKeyCursors;
+
 		/** Make serialize a friend, so the serializer can access private data members.
 		 *  (see custom serialization functions in serializer.hpp)
 		 */
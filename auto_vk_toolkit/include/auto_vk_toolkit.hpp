@@ -27,6 +27,8 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <future>
 #include <cstdlib>
 #include <typeindex>
 #include <type_traits>
@@ -34,6 +36,8 @@
 #include <cstdint>
 #include <chrono>
 #include <filesystem>
+#include <span>
+#include <bit>
 
 #include <cstdio>
 #include <cassert>
@@ -79,6 +83,8 @@
 #include <glm/gtx/transform2.hpp>
 #include <glm/gtx/hash.hpp>
 #include <glm/gtx/compatibility.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+#include <glm/gtc/packing.hpp>
 
 #include <gli/load.hpp> // load DDS, KTX or KMG textures from files or memory.
 #include <gli/core/flip.hpp>
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "material_image_helpers.hpp"
+#include "packed_animation.hpp"
+#include "serializer.hpp"
+#include "thread_pool.hpp"
+
+namespace avk
+{
+	/** Formats in which the bone transforms of a baked_animation are stored */
+	enum struct baked_bone_format
+	{
+		/** 16 floats per bone: the column-major bone matrix. Exact at the frames, for any kind of bone matrix. */
+		matrix,
+
+		/** 8 floats per bone: a unit dual quaternion, i.e. the real part (x, y, z, w) followed by the dual part (x, y, z, w).
+		 *	It represents only the rotation and translation of the bone matrix, i.e. scaling and shearing are lost.
+		 *	Suitable for rigid skeletons. */
+		dual_quaternion,
+
+		/** 10 floats per bone: the rotation as quaternion (x, y, z, w), the translation (x, y, z), and the scaling (x, y, z),
+		 *	which are applied in the order scaling, rotation, translation. Shearing is lost. */
+		translation_rotation_scale,
+	};
+
+	/**	Bone transforms of an animation clip, sampled at a fixed rate and stored in one contiguous table, which is created by
+	 *	bake_animation. Playback is reduced to fetching two frames of the table and interpolating between them per bone,
+	 *	i.e. there are no key lookups, no slerps and no matrix concatenations along the node hierarchy. This trades exactness
+	 *	between the frames for speed, which is usually fine for background characters and crowds.
+	 *	The table can be stored in a cache file with serialize and uploaded to the GPU with create_baked_animation_buffer.
+	 */
+	struct baked_animation
+	{
+		/** The format of the bone transforms in mData */
+		baked_bone_format mFormat = baked_bone_format::matrix;
+		/** The number of frames per second. It can be slightly higher than requested, s.t. the clip's end is a frame. */
+		double mFramesPerSecond = 0.0;
+		/** The time of the first frame in seconds, i.e. the clip's start time */
+		double mStartTime = 0.0;
+		/** The number of frames, which is at least 1 */
+		uint32_t mNumberOfFrames = 0;
+		/** The number of bone transforms per frame, i.e. the number of bone matrices which packed_animation writes for
+		 *	one instance, including the ones which are not written because of gaps between the meshes' bone index ranges. */
+		uint32_t mBonesPerFrame = 0;
+		/** The bone transforms of all frames, frame after frame, each with mBonesPerFrame entries of floats_per_bone floats */
+		std::vector<float> mData;
+
+		/** Returns the number of floats per bone transform, which depends on mFormat */
+		size_t floats_per_bone() const;
+
+		/** Returns the number of floats per frame */
+		size_t floats_per_frame() const { return floats_per_bone() * mBonesPerFrame; }
+
+		/** Returns the time of the last frame in seconds */
+		double end_time() const { return mStartTime + (mNumberOfFrames - 1) / mFramesPerSecond; }
+
+		/** Returns the bone transforms of the given frame in the format of mFormat */
+		std::span<const float> frame(size_t aFrameIndex) const { return std::span<const float>(mData).subspan(aFrameIndex * floats_per_frame(), floats_per_frame()); }
+
+		/** Returns the number of bytes of the table */
+		size_t size_in_bytes() const { return mData.size() * sizeof(float); }
+
+		/**	Interpolates the bone transforms between the two frames which enclose the given time and writes the resulting bone
+		 *	matrices into one single contiguous piece of memory, in the same layout as packed_animation::animate_into_single_target_buffer.
+		 *	Matrices and translations are interpolated linearly, rotations and dual quaternions with normalized lerp.
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at. It is clamped to the range of the frames.
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void sample(double aTime, glm::mat4* aTargetMemory) const;
+
+		/**	Samples multiple instances, each at its own time, and writes the bone matrices of each instance into its own region
+		 *	of the target memory. The instances are distributed across the threads of the given pool.
+		 *	@param	aTimes				Time in seconds to calculate the bone matrices at, one per instance
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix of the first instance shall be written to
+		 *	@param	aInstanceStride		Offset in matrices between the first bone matrices of two consecutive instances.
+		 *								Must be at least mBonesPerFrame, which is used if no value is given.
+		 *	@param	aThreadPool			The pool whose threads sample the instances (along with the calling thread)
+		 */
+		void sample_instances(std::span<const double> aTimes, glm::mat4* aTargetMemory, std::optional<size_t> aInstanceStride = {}, thread_pool& aThreadPool = thread_pool::shared()) const;
+	};
+
+	/**	Bakes an animation clip into a table of bone transforms which are sampled at a fixed rate.
+	 *	@param	aAnimation			The animation, which is evaluated at every frame
+	 *	@param	aClip				The animation clip, which determines the time range of the table
+	 *	@param	aFramesPerSecond	The minimum sampling rate. The actual rate is chosen s.t. the first and the last frame
+	 *								are at the clip's start and end, respectively.
+	 *	@param	aFormat				The format in which the bone transforms are stored
+	 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by the bone transforms
+	 */
+	baked_animation bake_animation(const packed_animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_bone_format aFormat = baked_bone_format::matrix, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space);
+
+	/**	Bakes an animation clip into a table of bone transforms which are sampled at a fixed rate, or loads it from cache.
+	 *	@param	aSerializer			The serializer which the table is written to or read from
+	 *	@param	aAnimation			The animation. It is only evaluated if the serializer is in serialize mode.
+	 *	@param	aClip				The animation clip, which determines the time range of the table
+	 *	@param	aFramesPerSecond	The minimum sampling rate, see bake_animation
+	 *	@param	aFormat				The format in which the bone transforms are stored
+	 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by the bone transforms
+	 */
+	baked_animation bake_animation_cached(serializer& aSerializer, const packed_animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_bone_format aFormat = baked_bone_format::matrix, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space);
+
+	/**	Creates a device buffer that contains the table of a baked animation, e.g. to sample it in a shader.
+	 *	The bone transforms of frame f start at float index f * floats_per_frame() of the buffer.
+	 *	@param	aBakedAnimation		The baked animation
+	 *	@param	aUsageFlags			Additional usage flags that the buffer is created with
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A storage buffer in device memory which will contain the table. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	std::tuple<avk::buffer, avk::command::action_type_command> create_baked_animation_buffer(const baked_animation& aBakedAnimation, vk::BufferUsageFlags aUsageFlags = {});
+
+	/** Serialization/deserialization method for baked_animation.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, baked_animation& aValue)
+	{
+		aArchive(aValue.mFormat, aValue.mFramesPerSecond, aValue.mStartTime, aValue.mNumberOfFrames, aValue.mBonesPerFrame, aValue.mData);
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+namespace avk
+{
+	/** Axis-aligned bounding box. A default-constructed box is empty, i.e. mMin > mMax. */
+	struct bounding_box
+	{
+		glm::vec3 mMin{ std::numeric_limits<float>::max() };
+		glm::vec3 mMax{ std::numeric_limits<float>::lowest() };
+
+		/** Returns true if the box does not contain any point */
+		bool empty() const { return mMin.x > mMax.x || mMin.y > mMax.y || mMin.z > mMax.z; }
+		glm::vec3 center() const { return 0.5f * (mMin + mMax); }
+		glm::vec3 extent() const { return mMax - mMin; }
+
+		/** Grows the box s.t. it contains the given point */
+		void extend(const glm::vec3& aPoint)
+		{
+			mMin = glm::min(mMin, aPoint);
+			mMax = glm::max(mMax, aPoint);
+		}
+
+		/** Grows the box s.t. it contains the given box */
+		void extend(const bounding_box& aOther)
+		{
+			mMin = glm::min(mMin, aOther.mMin);
+			mMax = glm::max(mMax, aOther.mMax);
+		}
+	};
+
+	/** Bounding sphere. A negative radius denotes an empty sphere. */
+	struct bounding_sphere
+	{
+		glm::vec3 mCenter{ 0.0f };
+		float mRadius = -1.0f;
+
+		/** Returns true if the sphere does not contain any point */
+		bool empty() const { return mRadius < 0.0f; }
+	};
+
+	/** Cone which bounds the normals of a set of triangles, used for backface culling of whole clusters of triangles.
+	 *	All triangles are back-facing for a camera at position c if
+	 *		dot(normalize(mApex - c), mAxis) >= mCutoff
+	 */
+	struct normal_cone
+	{
+		glm::vec3 mApex{ 0.0f };
+		glm::vec3 mAxis{ 0.0f, 0.0f, 1.0f };
+		/** Sine of the half opening angle of the cone. A value greater than 1 means that the normals do not fit into a
+		 *	cone with an opening angle below 180 degrees (or that there are no triangles), i.e. the test never succeeds. */
+		float mCutoff = 2.0f;
+
+		/** Returns true if the cone can never be culled */
+		bool degenerate() const { return mCutoff > 1.0f; }
+	};
+
+	/** Bounding sphere and axis-aligned bounding box in a layout which is compatible
+	 *	with both std140 and std430, i.e. which can be uploaded to buffers directly. */
+	struct bounding_volume_gpu_data
+	{
+		/** Center of the bounding sphere in xyz, its radius in w */
+		glm::vec4 mSphere;
+		/** Minimum corner of the bounding box in xyz, w is unused */
+		glm::vec4 mBoxMin;
+		/** Maximum corner of the bounding box in xyz, w is unused */
+		glm::vec4 mBoxMax;
+	};
+
+	/** Computes the axis-aligned bounding box of the given points. */
+	bounding_box compute_bounding_box(std::span<const glm::vec3> aPoints);
+
+	/** Computes a tight bounding sphere of the given points.
+	 *	An approximation based on Ritter's algorithm is used, which is refined by a second pass over
+	 *	the points. The result is never larger than the sphere which encloses the bounding box.
+	 */
+	bounding_sphere compute_bounding_sphere(std::span<const glm::vec3> aPoints);
+
+	/** Computes the cone which bounds the normals of the given triangles.
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aIndices		Triangle list indices into aPositions
+	 */
+	normal_cone compute_normal_cone(std::span<const glm::vec3> aPositions, std::span<const uint32_t> aIndices);
+
+	/** Computes the cone which bounds the normals of the given triangles.
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aIndices		Triangle list indices into aPositions, e.g. the indices of a meshlet
+	 */
+	normal_cone compute_normal_cone(std::span<const glm::vec3> aPositions, std::span<const uint8_t> aIndices);
+
+	/** Computes the bounding sphere which encloses the given bounding box. */
+	bounding_sphere bounding_sphere_for(const bounding_box& aBox);
+
+	/** Computes the smallest sphere which encloses both of the given spheres. */
+	bounding_sphere merge(const bounding_sphere& aFirst, const bounding_sphere& aSecond);
+
+	/** Computes the axis-aligned bounding box of the given box after transforming it with the given matrix. */
+	bounding_box transformed(const bounding_box& aBox, const glm::mat4& aMatrix);
+
+	/** Computes a bounding sphere of the given sphere after transforming it with the given matrix.
+	 *	The radius is scaled by the matrix's largest axis scale. */
+	bounding_sphere transformed(const bounding_sphere& aSphere, const glm::mat4& aMatrix);
+
+	/** Converts the given bounding volumes into their GPU representation. */
+	inline bounding_volume_gpu_data to_gpu_data(const bounding_box& aBox, const bounding_sphere& aSphere)
+	{
+		return bounding_volume_gpu_data{ glm::vec4{ aSphere.mCenter, aSphere.mRadius }, glm::vec4{ aBox.mMin, 0.0f }, glm::vec4{ aBox.mMax, 0.0f } };
+	}
+
+	/** Serialization/deserialization method for bounding_box.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, bounding_box& aValue)
+	{
+		aArchive(aValue.mMin, aValue.mMax);
+	}
+
+	/** Serialization/deserialization method for bounding_sphere.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, bounding_sphere& aValue)
+	{
+		aArchive(aValue.mCenter, aValue.mRadius);
+	}
+
+	/** Serialization/deserialization method for normal_cone.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, normal_cone& aValue)
+	{
+		aArchive(aValue.mApex, aValue.mAxis, aValue.mCutoff);
+	}
+
+	/** Serialization/deserialization method for bounding_volume_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, bounding_volume_gpu_data& aValue)
+	{
+		aArchive(aValue.mSphere, aValue.mBoxMin, aValue.mBoxMax);
+	}
+}
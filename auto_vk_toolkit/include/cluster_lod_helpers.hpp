@@ -0,0 +1,201 @@
+#pragma once
+
+#include "meshlet_helpers.hpp"
+#include "mesh_simplification_helpers.hpp"
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** Configuration of build_cluster_lod_hierarchy */
+	struct cluster_lod_config
+	{
+		/** The maximum number of vertices of a cluster. Must not exceed 256. */
+		uint32_t mMaxVertices = 64;
+		/** The maximum number of indices of a cluster. */
+		uint32_t mMaxIndices = 378;
+		/** The number of neighboring clusters which are grouped, simplified, and re-split together */
+		uint32_t mClustersPerGroup = 4;
+		/** A group is only replaced by coarser clusters if simplification reduces its triangle count to at most this fraction */
+		float mMinReduction = 0.85f;
+		/** The maximum number of levels of the hierarchy, including the original clusters */
+		uint32_t mMaxLevels = 24;
+	};
+
+	/** A cluster of triangles within a cluster LOD hierarchy, i.e. a meshlet plus the information which
+	 *	is required to decide whether it is part of a view-dependent cut through the hierarchy.
+	 *	A cluster is part of the cut if its own error is acceptable, but the error of its parents is not,
+	 *	where errors are projected onto the screen using the respective bounding spheres (see select_lod_clusters).
+	 *	All clusters which have been generated from the same group share the same error and bounds, as do all
+	 *	clusters which are simplified within the same group, which guarantees a consistent, crack-free cut.
+	 */
+	struct lod_cluster
+	{
+		/** The cluster's geometry. mVertices index the vertices of the mesh that the hierarchy has been built for.
+		 *	Its bounding volumes and normal cone are set, its model is not. */
+		meshlet mMeshlet;
+		/** 0 for clusters of the original mesh, increasing with every simplification step */
+		uint32_t mLevel = 0;
+		/** The geometric error of this cluster w.r.t. the original mesh, in object space. Zero for level 0. */
+		float mError = 0.0f;
+		/** The bounds which mError refers to. They contain the bounds of all clusters this cluster has been generated from. */
+		bounding_sphere mLodBounds;
+		/** The error of the clusters which replace this cluster, or the maximum float value if there are none */
+		float mParentError = std::numeric_limits<float>::max();
+		/** The bounds which mParentError refers to */
+		bounding_sphere mParentLodBounds;
+		/** The group in which this cluster has been simplified, i.e. where it is a child. Not set for root clusters. */
+		std::optional<uint32_t> mGroup;
+		/** The group from which this cluster has been generated, i.e. where it is a parent. Not set for level 0 clusters. */
+		std::optional<uint32_t> mSourceGroup;
+	};
+
+	/** A group of neighboring clusters which have been simplified together. It forms a node of the hierarchy's DAG,
+	 *	which connects the group's children to the coarser clusters which have been generated from them. */
+	struct lod_cluster_group
+	{
+		/** Indices of the clusters which have been simplified in this group */
+		std::vector<uint32_t> mChildren;
+		/** Indices of the clusters which have been generated from the simplified group */
+		std::vector<uint32_t> mParents;
+		/** The geometric error of the parents w.r.t. the original mesh, in object space */
+		float mError = 0.0f;
+		/** The bounds which mError refers to */
+		bounding_sphere mBounds;
+	};
+
+	/** A DAG of clusters at different levels of detail, built by build_cluster_lod_hierarchy. */
+	struct cluster_lod_hierarchy
+	{
+		/** All clusters of all levels, ordered by level */
+		std::vector<lod_cluster> mClusters;
+		/** All groups, in the order in which they have been formed, i.e. coarser groups come later */
+		std::vector<lod_cluster_group> mGroups;
+		/** The number of levels */
+		uint32_t mNumLevels = 0;
+	};
+
+	/** The level of detail information of a lod_cluster for GPU usage, e.g. for selecting clusters in a task shader.
+	 *	The layout is compatible with both std140 and std430. A cluster is part of the cut if
+	 *		projected(mError, mLodBounds) <= threshold && projected(mParentError, mParentLodBounds) > threshold
+	 *	where projected(e, s) = e / max(distance(s.xyz, cameraPosition) - s.w, epsilon) * (viewportHeight / (2 * tan(verticalFov / 2)))
+	 */
+	struct lod_cluster_gpu_data
+	{
+		/** Center of mLodBounds in xyz, its radius in w */
+		glm::vec4 mLodBounds;
+		/** Center of mParentLodBounds in xyz, its radius in w */
+		glm::vec4 mParentLodBounds;
+		float mError;
+		float mParentError;
+		uint32_t mLevel;
+		uint32_t mPadding;
+	};
+
+	/** Builds a hierarchy of clusters at different levels of detail for a triangle list.
+	 *	The original triangles are divided into clusters with divide_triangles_into_meshlets. Then, level by level,
+	 *	neighboring clusters are grouped, each group is simplified to half of its triangles with generate_lods while the
+	 *	group's border is kept in place, and the simplified group is divided into new clusters. This repeats until no
+	 *	further simplification is possible. Since group borders never move, clusters of different levels of detail
+	 *	can be combined without cracks, as long as all clusters of a group make the same decision (see lod_cluster).
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Cluster sizes and grouping parameters
+	 */
+	cluster_lod_hierarchy build_cluster_lod_hierarchy(const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const cluster_lod_config& aConfig = {});
+
+	/** Builds a hierarchy of clusters at different levels of detail for the given mesh of a model.
+	 *	See the other overload for details.
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model. It is assigned to the clusters' meshlets.
+	 *	@param	aConfig			Cluster sizes and grouping parameters
+	 */
+	cluster_lod_hierarchy build_cluster_lod_hierarchy(const model_t& aModel, mesh_index_t aMeshIndex, const cluster_lod_config& aConfig = {});
+
+	/** Builds a hierarchy of clusters at different levels of detail for a triangle list, or loads it from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Cluster sizes and grouping parameters
+	 */
+	cluster_lod_hierarchy build_cluster_lod_hierarchy_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const cluster_lod_config& aConfig = {});
+
+	/** Builds a hierarchy of clusters at different levels of detail for the given mesh of a model, or loads it from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model
+	 *	@param	aConfig			Cluster sizes and grouping parameters
+	 */
+	cluster_lod_hierarchy build_cluster_lod_hierarchy_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const cluster_lod_config& aConfig = {});
+
+	/** Selects the clusters which form the view-dependent cut through the hierarchy for the given camera.
+	 *	This is the CPU-side reference of what a task shader would do with lod_cluster_gpu_data.
+	 *	@param	aHierarchy			The hierarchy
+	 *	@param	aCameraPosition		The camera's position in the space of the hierarchy's vertices
+	 *	@param	aVerticalFov		The camera's vertical field of view in radians
+	 *	@param	aViewportHeight		The height of the viewport in pixels
+	 *	@param	aMaxPixelError		The maximum permitted error in pixels
+	 *	@return	Indices of the selected clusters
+	 */
+	std::vector<uint32_t> select_lod_clusters(const cluster_lod_hierarchy& aHierarchy, const glm::vec3& aCameraPosition, float aVerticalFov, float aViewportHeight, float aMaxPixelError = 1.0f);
+
+	/** Gets the meshlets of all clusters of the hierarchy, in the order of its clusters, e.g. to pass them to convert_for_gpu_usage. */
+	std::vector<meshlet> get_meshlets(const cluster_lod_hierarchy& aHierarchy);
+
+	/** Converts the level of detail information of all clusters into a GPU usable representation,
+	 *	in the same order as the meshlets returned by get_meshlets.
+	 *	@param	aHierarchy	The hierarchy
+	 */
+	std::vector<lod_cluster_gpu_data> convert_cluster_lod_for_gpu_usage(const cluster_lod_hierarchy& aHierarchy);
+
+	/** Converts the level of detail information of all clusters into a GPU usable representation, or loads it from cache.
+	 *  @param  aSerializer The serializer for the level of detail information.
+	 *	@param	aHierarchy	The hierarchy
+	 */
+	std::vector<lod_cluster_gpu_data> convert_cluster_lod_for_gpu_usage_cached(serializer& aSerializer, const cluster_lod_hierarchy& aHierarchy);
+
+	/** Serialization/deserialization method for lod_cluster. The model of its meshlet is not serialized.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, lod_cluster& aValue)
+	{
+		auto& ml = aValue.mMeshlet;
+		aArchive(ml.mMeshIndex, ml.mVertices, ml.mIndices, ml.mVertexCount, ml.mIndexCount, ml.mBoundingBox, ml.mBoundingSphere, ml.mNormalCone);
+		aArchive(aValue.mLevel, aValue.mError, aValue.mLodBounds, aValue.mParentError, aValue.mParentLodBounds, aValue.mGroup, aValue.mSourceGroup);
+	}
+
+	/** Serialization/deserialization method for lod_cluster_group.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, lod_cluster_group& aValue)
+	{
+		aArchive(aValue.mChildren, aValue.mParents, aValue.mError, aValue.mBounds);
+	}
+
+	/** Serialization/deserialization method for cluster_lod_hierarchy.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, cluster_lod_hierarchy& aValue)
+	{
+		aArchive(aValue.mClusters, aValue.mGroups, aValue.mNumLevels);
+	}
+
+	/** Serialization/deserialization method for lod_cluster_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, lod_cluster_gpu_data& aValue)
+	{
+		aArchive(aValue.mLodBounds, aValue.mParentLodBounds, aValue.mError, aValue.mParentError, aValue.mLevel, aValue.mPadding);
+	}
+}
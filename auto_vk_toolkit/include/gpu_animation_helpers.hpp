@@ -0,0 +1,161 @@
+#pragma once
+
+#include "material_image_helpers.hpp"
+#include "packed_animation.hpp"
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** One node of a packed_animation for GPU usage. The layout is compatible with std430.
+	 *	Nodes are stored in parent-before-child order, grouped by their depth in the hierarchy. */
+	struct packed_animation_node_gpu_data
+	{
+		/** Transform between the animated parent and the node, see packed_animation */
+		glm::mat4 mParentTransform;
+		/** Index of the animated parent node, or 0xFFFFFFFF if the node has no animated parent */
+		uint32_t mParentIndex;
+		/** Ranges of the node's keys in packed_animation_gpu_data::mKeyTimes and mKeyValues. A count of 0 means identity. */
+		uint32_t mTranslationKeysOffset;
+		uint32_t mTranslationKeyCount;
+		uint32_t mRotationKeysOffset;
+		uint32_t mRotationKeyCount;
+		uint32_t mScalingKeysOffset;
+		uint32_t mScalingKeyCount;
+		uint32_t mPadding;
+	};
+
+	/** One bone matrix of a packed_animation for GPU usage. The layout is compatible with std430.
+	 *	The bone matrix is computed as mInverseMeshRootMatrix * globalTransform[mNodeIndex] * mInverseBindPoseMatrix. */
+	struct packed_animation_bone_gpu_data
+	{
+		/** The inverse mesh root matrix for mesh space bone matrices, the identity for model space bone matrices */
+		glm::mat4 mInverseMeshRootMatrix;
+		glm::mat4 mInverseBindPoseMatrix;
+		/** The node whose global transform is used */
+		uint32_t mNodeIndex;
+		/** The index of the bone matrix within the bone matrices of an instance */
+		uint32_t mTargetIndex;
+		uint32_t mPadding[2];
+	};
+
+	/** Push constants of the compute shader which evaluates packed animations, see packed_animation_gpu_data. */
+	struct packed_animation_push_constants
+	{
+		/** Ticks per second of the animation clip, which converts the instances' times from seconds into ticks */
+		float mTicksPerSecond;
+		uint32_t mNumNodes;
+		uint32_t mNumLevels;
+		uint32_t mNumBones;
+		/** Offset in matrices between the first bone matrices of two consecutive instances in the target buffer */
+		uint32_t mInstanceStride;
+		/** Number of instances, i.e. of entries of the buffer of times. One workgroup is dispatched per instance. */
+		uint32_t mNumInstances;
+	};
+
+	/**	All data of a packed_animation which is required to evaluate it on the GPU: A compute shader with one workgroup
+	 *	per instance samples the local transforms of all nodes at the instance's time, concatenates them level by level
+	 *	with the global transforms of their parents, and writes the bone matrices into the target buffer.
+	 *	This means that only the times of the instances have to be uploaded every frame.
+	 *	The shader which implements this is animate_bones.comp of the skinned_meshlets example. It produces the same results
+	 *	as packed_animation::animate_into_single_target_buffer, up to floating point precision.
+	 */
+	struct packed_animation_gpu_data
+	{
+		std::vector<packed_animation_node_gpu_data> mNodes;
+		/** The nodes of level l (i.e. with depth l in the hierarchy) are in range [mLevelOffsets[l], mLevelOffsets[l+1]) of mNodes */
+		std::vector<uint32_t> mLevelOffsets;
+		/** Pooled key times of all channels of all nodes, in ticks */
+		std::vector<float> mKeyTimes;
+		/** Pooled key values of all channels of all nodes: translations and scalings in xyz, rotations as quaternions in xyzw */
+		std::vector<glm::vec4> mKeyValues;
+		std::vector<packed_animation_bone_gpu_data> mBones;
+		/** The number of bone matrices which one instance occupies, i.e. the minimum instance stride */
+		uint32_t mNumBoneMatrices = 0;
+		/** See packed_animation::classified_tick_range */
+		std::optional<std::tuple<double, double>> mClassifiedTickRange;
+	};
+
+	/** Device buffers which contain a packed_animation_gpu_data, created by create_gpu_buffers */
+	struct packed_animation_gpu_buffers
+	{
+		avk::buffer mNodes;
+		avk::buffer mLevelOffsets;
+		avk::buffer mKeyTimes;
+		avk::buffer mKeyValues;
+		avk::buffer mBones;
+		/** Scratch space for the global transforms of all nodes of all instances */
+		avk::buffer mGlobalTransforms;
+		uint32_t mNumNodes = 0;
+		uint32_t mNumLevels = 0;
+		uint32_t mNumBones = 0;
+		uint32_t mNumBoneMatrices = 0;
+		/** The maximum number of instances which can be evaluated with one dispatch, due to the size of mGlobalTransforms */
+		uint32_t mMaxInstances = 0;
+		/** See packed_animation::classified_tick_range */
+		std::optional<std::tuple<double, double>> mClassifiedTickRange;
+
+		/**	Returns the push constants for evaluating the given number of instances of the given clip.
+		 *	@param	aClip				Animation clip which the instances' times refer to
+		 *	@param	aNumInstances		The number of instances, which must not exceed mMaxInstances
+		 *	@param	aInstanceStride		Offset in matrices between the first bone matrices of two consecutive instances. Defaults to mNumBoneMatrices.
+		 */
+		packed_animation_push_constants push_constants(const animation_clip_data& aClip, uint32_t aNumInstances, std::optional<uint32_t> aInstanceStride = {}) const;
+	};
+
+	/**	Converts a packed_animation into a representation for GPU usage. Quantized keys are converted to full precision.
+	 *	@param	aAnimation		The animation
+	 *	@param	aTargetSpace	The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+	 */
+	packed_animation_gpu_data convert_for_gpu_usage(const packed_animation& aAnimation, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space);
+
+	/**	Converts a packed_animation into a representation for GPU usage, or loads it from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aAnimation		The animation. It is only converted if the serializer is in serialize mode.
+	 *	@param	aTargetSpace	The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+	 */
+	packed_animation_gpu_data convert_for_gpu_usage_cached(serializer& aSerializer, const packed_animation& aAnimation, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space);
+
+	/**	Creates the device buffers for evaluating an animation on the GPU.
+	 *	@param	aGpuData		The GPU representation of the animation
+	 *	@param	aMaxInstances	The maximum number of instances which shall be evaluated with one dispatch
+	 *	@return	A tuple containing the following values:
+	 *			<0>: The buffers. Attention: The user of this function must ensure that they are not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	std::tuple<packed_animation_gpu_buffers, std::vector<avk::recorded_commands_t>> create_gpu_buffers(const packed_animation_gpu_data& aGpuData, uint32_t aMaxInstances = 1);
+
+	/** Serialization/deserialization method for packed_animation_node_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, packed_animation_node_gpu_data& aValue)
+	{
+		aArchive(aValue.mParentTransform, aValue.mParentIndex,
+			aValue.mTranslationKeysOffset, aValue.mTranslationKeyCount, aValue.mRotationKeysOffset, aValue.mRotationKeyCount, aValue.mScalingKeysOffset, aValue.mScalingKeyCount,
+			aValue.mPadding);
+	}
+
+	/** Serialization/deserialization method for packed_animation_bone_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, packed_animation_bone_gpu_data& aValue)
+	{
+		aArchive(aValue.mInverseMeshRootMatrix, aValue.mInverseBindPoseMatrix, aValue.mNodeIndex, aValue.mTargetIndex, aValue.mPadding);
+	}
+
+	/** Serialization/deserialization method for packed_animation_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, packed_animation_gpu_data& aValue)
+	{
+		aArchive(aValue.mNodes, aValue.mLevelOffsets, aValue.mKeyTimes, aValue.mKeyValues, aValue.mBones, aValue.mNumBoneMatrices, aValue.mClassifiedTickRange);
+	}
+}
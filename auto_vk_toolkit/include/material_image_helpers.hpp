@@ -3,6 +3,7 @@
 #include "image_data.hpp"
 #include "material_gpu_data_ext.hpp"
 #include "model.hpp"
+#include "quantized_vertex_data.hpp"
 #include "serializer.hpp"
 #include "context_vulkan.hpp"
 
@@ -1145,6 +1146,50 @@ namespace avk
 	 */
 	extern std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices);
 	// TODO ^ function definition not found
+
+	/**	Get bone weights AND bone indices from the given selection of models and associated mesh indices.
+	 *	Both are gathered in one single pass per mesh, which is faster than calling `get_bone_weights` and `get_bone_indices` separately.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Tuple of combined bone weights data and combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get bone weights AND bone indices from the given selection of models and associated mesh indices.
+	 *	Both are gathered in one single pass per mesh, which is faster than calling `get_bone_weights` and `get_bone_indices` separately.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Tuple of combined bone weights data and combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get bone weights AND bone indices from the given selection of models and associated mesh indices for an animation which writes bones in the "single target buffer" mode.
+	 *	Both are gathered in one single pass per mesh, which is faster than calling `get_bone_weights` and `get_bone_indices_for_single_target_buffer` separately.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aReferenceMeshIndices		The correct offset for the given mesh index is determined based on this set. I.e. the offset will be the accumulated value
+	 *										of all previous #bone-matrices in the set before the mesh with the given index.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@return	Tuple of combined bone weights data and combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices, bool aNormalizeBoneWeights = false);
+
+	/**	Get bone weights AND bone indices from the given selection of models and associated mesh indices for an animation which writes bones in the "single target buffer" mode.
+	 *	Both are gathered in one single pass per mesh, which is faster than calling `get_bone_weights` and `get_bone_indices_for_single_target_buffer` separately.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aReferenceMeshIndices		The correct offset for the given mesh index is determined based on this set. I.e. the offset will be the accumulated value
+	 *										of all previous #bone-matrices in the set before the mesh with the given index.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@return	Tuple of combined bone weights data and combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices, bool aNormalizeBoneWeights = false);
 	
 	/**	Get a buffer containing bone indices from the given input data.
 	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
@@ -1424,6 +1469,400 @@ namespace avk
 		}
 		return create_buffer_cached<std::vector<glm::vec3>, Metas...>(aSerializer, textureCoordinatesData, avk::content_description::texture_coordinate, aUsageFlags);
 	}
+
+	/**	Get 16-bit quantized positions from the given selection of models and associated mesh indices.
+	 *	The positions are quantized relative to axis-aligned bounds, either per mesh or common for all selected meshes.
+	 *	Use the returned dequantization constants to reconstruct the positions (see `position_dequantization`).
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aPerMeshBounds				If true, every mesh is quantized relative to its own bounds, which gives the best precision.
+	 *										In this case, the fourth component of every quantized position contains the raw index of the
+	 *										mesh's dequantization constants, s.t. combined buffers can be drawn with a single draw call
+	 *										(a shader reads it as normalized value w and can recover the index via `uint(round(w * 65535.0))`).
+	 *										If false, all meshes are quantized relative to their common bounds, and the fourth component is zero.
+	 *	@return	A tuple of the following elements:
+	 *			<0>: Combined quantized positions data of all specified model + mesh-indices.
+	 *			<1>: Dequantization constants, either one per selected mesh (in the order of the selection), or one for all of them.
+	 */
+	extern std::tuple<std::vector<unorm16x4>, std::vector<position_dequantization>> get_quantized_positions(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds = true);
+
+	/**	Get 16-bit quantized positions from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aPerMeshBounds				Whether to quantize relative to per-mesh bounds or relative to common bounds (see `get_quantized_positions`).
+	 *	@return	A tuple of the quantized positions and the dequantization constants (see `get_quantized_positions`).
+	 */
+	extern std::tuple<std::vector<unorm16x4>, std::vector<position_dequantization>> get_quantized_positions_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds = true);
+
+	/**	Get a buffer containing 16-bit quantized positions (format vk::Format::eR16G16B16A16Unorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aPerMeshBounds				Whether to quantize relative to per-mesh bounds or relative to common bounds (see `get_quantized_positions`).
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized positions. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <2>) have completed execution.
+	 *			<1>: The dequantization constants (see `get_quantized_positions`)
+	 *			<2>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, std::vector<position_dequantization>, avk::command::action_type_command> create_quantized_positions_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds = true, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		auto [positionsData, dequantizationData] = get_quantized_positions(aModelsAndSelectedMeshes, aPerMeshBounds);
+		auto [buffer, actionTypeCommand] = create_buffer<std::vector<unorm16x4>, Metas...>(positionsData, avk::content_description::position, aUsageFlags);
+		return std::make_tuple(std::move(buffer), std::move(dequantizationData), std::move(actionTypeCommand));
+	}
+
+	/** Get a buffer containing 16-bit quantized positions (format vk::Format::eR16G16B16A16Unorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aPerMeshBounds				Whether to quantize relative to per-mesh bounds or relative to common bounds (see `get_quantized_positions`).
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized positions. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <2>) have completed execution.
+	 *			<1>: The dequantization constants (see `get_quantized_positions`)
+	 *			<2>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, std::vector<position_dequantization>, avk::command::action_type_command> create_quantized_positions_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds = true, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<unorm16x4> positionsData;
+		std::vector<position_dequantization> dequantizationData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			std::tie(positionsData, dequantizationData) = get_quantized_positions(aModelsAndSelectedMeshes, aPerMeshBounds);
+		}
+		aSerializer.archive(dequantizationData);
+		auto [buffer, actionTypeCommand] = create_buffer_cached<std::vector<unorm16x4>, Metas...>(aSerializer, positionsData, avk::content_description::position, aUsageFlags);
+		return std::make_tuple(std::move(buffer), std::move(dequantizationData), std::move(actionTypeCommand));
+	}
+
+	/**	Get octahedral-encoded normals (see `encode_octahedral`) from the given selection of models and associated mesh indices.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	Combined encoded normals data of all specified model + mesh-indices.
+	 */
+	extern std::vector<snorm16x2> get_octahedral_normals(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get octahedral-encoded normals (see `encode_octahedral`) from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. The order is maintained.
+	 *	@return	Combined encoded normals data of all specified model + mesh-indices tuples.
+	 */
+	extern std::vector<snorm16x2> get_octahedral_normals_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get a buffer containing octahedral-encoded normals (format vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the encoded normals. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_octahedral_normals_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<snorm16x2>, Metas...>(get_octahedral_normals(aModelsAndSelectedMeshes), avk::content_description::normal, aUsageFlags);
+	}
+
+	/** Get a buffer containing octahedral-encoded normals (format vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the encoded normals. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_octahedral_normals_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<snorm16x2> normalsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			normalsData = get_octahedral_normals(aModelsAndSelectedMeshes);
+		}
+		return create_buffer_cached<std::vector<snorm16x2>, Metas...>(aSerializer, normalsData, avk::content_description::normal, aUsageFlags);
+	}
+
+	/**	Get octahedral-encoded tangents (see `encode_octahedral`) from the given selection of models and associated mesh indices.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	Combined encoded tangents data of all specified model + mesh-indices.
+	 */
+	extern std::vector<snorm16x2> get_octahedral_tangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get octahedral-encoded tangents (see `encode_octahedral`) from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. The order is maintained.
+	 *	@return	Combined encoded tangents data of all specified model + mesh-indices tuples.
+	 */
+	extern std::vector<snorm16x2> get_octahedral_tangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get a buffer containing octahedral-encoded tangents (format vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the encoded tangents. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_octahedral_tangents_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<snorm16x2>, Metas...>(get_octahedral_tangents(aModelsAndSelectedMeshes), avk::content_description::tangent, aUsageFlags);
+	}
+
+	/** Get a buffer containing octahedral-encoded tangents (format vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the encoded tangents. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_octahedral_tangents_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<snorm16x2> tangentsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			tangentsData = get_octahedral_tangents(aModelsAndSelectedMeshes);
+		}
+		return create_buffer_cached<std::vector<snorm16x2>, Metas...>(aSerializer, tangentsData, avk::content_description::tangent, aUsageFlags);
+	}
+
+	/**	Get 2D texture coordinates in half precision from the given selection of models and associated mesh indices.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aFlipY						Set to true to flip the y-coordinates (like `get_2d_texture_coordinates_flipped` does).
+	 *	@return	Combined half precision 2D texture coordinates data of all specified model + mesh-indices.
+	 */
+	extern std::vector<float16x2> get_half_precision_2d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipY = false);
+
+	/**	Get 2D texture coordinates in half precision from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. The order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aFlipY						Set to true to flip the y-coordinates (like `get_2d_texture_coordinates_flipped` does).
+	 *	@return	Combined half precision 2D texture coordinates data of all specified model + mesh-indices tuples.
+	 */
+	extern std::vector<float16x2> get_half_precision_2d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipY = false);
+
+	/**	Get a buffer containing 2D texture coordinates in half precision (format vk::Format::eR16G16Sfloat) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aFlipY						Set to true to flip the y-coordinates (like `get_2d_texture_coordinates_flipped` does).
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the given texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_half_precision_2d_texture_coordinates_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipY = false, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<float16x2>, Metas...>(get_half_precision_2d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet, aFlipY), avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/** Get a buffer containing 2D texture coordinates in half precision (format vk::Format::eR16G16Sfloat) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aFlipY						Set to true to flip the y-coordinates (like `get_2d_texture_coordinates_flipped` does).
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the given texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_half_precision_2d_texture_coordinates_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipY = false, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<float16x2> textureCoordinatesData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			textureCoordinatesData = get_half_precision_2d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet, aFlipY);
+		}
+		return create_buffer_cached<std::vector<float16x2>, Metas...>(aSerializer, textureCoordinatesData, avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/**	Get bone weights quantized to 8 bits each (see `quantize_bone_weights`) from the given selection of models and associated mesh indices.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@return	Combined quantized bone weights data of all specified model + mesh-indices.
+	 */
+	extern std::vector<unorm8x4> get_quantized_bone_weights(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false);
+
+	/**	Get bone weights quantized to 8 bits each (see `quantize_bone_weights`) from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@return	Combined quantized bone weights data of all specified model + mesh-indices.
+	 */
+	extern std::vector<unorm8x4> get_quantized_bone_weights_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false);
+
+	/**	Get a buffer containing bone weights quantized to 8 bits each (format vk::Format::eR8G8B8A8Unorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized bone weights. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_quantized_bone_weights_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<unorm8x4>, Metas...>(get_quantized_bone_weights(aModelsAndSelectedMeshes, aNormalizeBoneWeights), avk::content_description::bone_weight, aUsageFlags);
+	}
+
+	/** Get a buffer containing bone weights quantized to 8 bits each (format vk::Format::eR8G8B8A8Unorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aNormalizeBoneWeights		Set to true to apply normalization to the bone weights, s.t. their sum equals 1.
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized bone weights. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_quantized_bone_weights_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights = false, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<unorm8x4> boneWeightsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneWeightsData = get_quantized_bone_weights(aModelsAndSelectedMeshes, aNormalizeBoneWeights);
+		}
+		return create_buffer_cached<std::vector<unorm8x4>, Metas...>(aSerializer, boneWeightsData, avk::content_description::bone_weight, aUsageFlags);
+	}
+
+	/**	Get bone indices as 8-bit unsigned integers from the given selection of models and associated mesh indices.
+	 *	Throws if a bone index (including aBoneIndexOffset) exceeds 255.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::vector<glm::u8vec4> get_bone_indices_uint8(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get bone indices as 8-bit unsigned integers from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::vector<glm::u8vec4> get_bone_indices_uint8_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get bone indices as 16-bit unsigned integers from the given selection of models and associated mesh indices.
+	 *	Throws if a bone index (including aBoneIndexOffset) exceeds 65535.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::vector<glm::u16vec4> get_bone_indices_uint16(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get bone indices as 16-bit unsigned integers from the given selection of models and associated mesh indices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@return	Combined bone indices data of all specified model + mesh-indices.
+	 */
+	extern std::vector<glm::u16vec4> get_bone_indices_uint16_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u);
+
+	/**	Get a buffer containing bone indices as 8-bit (format vk::Format::eR8G8B8A8Uint) or 16-bit (format vk::Format::eR16G16B16A16Uint) unsigned integers from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	T							Either glm::u8vec4 or glm::u16vec4
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the bone indices. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename T, typename... Metas> requires std::same_as<T, glm::u8vec4> || std::same_as<T, glm::u16vec4>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_narrow_bone_indices_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		if constexpr (std::is_same_v<T, glm::u8vec4>) {
+			return create_buffer<std::vector<T>, Metas...>(get_bone_indices_uint8(aModelsAndSelectedMeshes, aBoneIndexOffset), avk::content_description::bone_index, aUsageFlags);
+		}
+		else {
+			return create_buffer<std::vector<T>, Metas...>(get_bone_indices_uint16(aModelsAndSelectedMeshes, aBoneIndexOffset), avk::content_description::bone_index, aUsageFlags);
+		}
+	}
+
+	/** Get a buffer containing bone indices as 8-bit (format vk::Format::eR8G8B8A8Uint) or 16-bit (format vk::Format::eR16G16B16A16Uint) unsigned integers from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aBoneIndexOffset			Offset to be added to the bone indices.
+	 *	@param	aUsageFlags					Additional usage flags that the buffers are created with.
+	 *	@tparam	T							Either glm::u8vec4 or glm::u16vec4
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the bone indices. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename T, typename... Metas> requires std::same_as<T, glm::u8vec4> || std::same_as<T, glm::u16vec4>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_narrow_bone_indices_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset = 0u, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<T> boneIndicesData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			if constexpr (std::is_same_v<T, glm::u8vec4>) {
+				boneIndicesData = get_bone_indices_uint8(aModelsAndSelectedMeshes, aBoneIndexOffset);
+			}
+			else {
+				boneIndicesData = get_bone_indices_uint16(aModelsAndSelectedMeshes, aBoneIndexOffset);
+			}
+		}
+		return create_buffer_cached<std::vector<T>, Metas...>(aSerializer, boneIndicesData, avk::content_description::bone_index, aUsageFlags);
+	}
+
+	/**	Get the bounding volumes of the given selection of models and associated mesh indices in their GPU representation.
+	 *	These are the bounding volumes which the models have computed at load time (see `model_t::bounding_box_for_mesh`
+	 *	and `model_t::bounding_sphere_for_mesh`), i.e. they refer to the meshes' own coordinate spaces, just like the
+	 *	positions which `get_vertices_and_indices` returns.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *	@return	One entry per selected mesh, in the order of the selection.
+	 */
+	extern std::vector<bounding_volume_gpu_data> get_bounding_volumes(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get the bounding volumes of the given selection of models and associated mesh indices in their GPU representation.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *	@return	One entry per selected mesh, in the order of the selection.
+	 */
+	extern std::vector<bounding_volume_gpu_data> get_bounding_volumes_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
 	
 	/**	Create a new sampler with the given configuration parameters
 	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "model.hpp"
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** Statistics about how well an index buffer makes use of the post-transform vertex cache. */
+	struct vertex_cache_statistics
+	{
+		/** Average cache miss ratio: transformed vertices per triangle. Lies in the range [0.5, 3], lower is better. */
+		float mAcmr = 0.0f;
+		/** Average transformed vertex ratio: transformed vertices per referenced vertex. 1 is optimal. */
+		float mAtvr = 0.0f;
+		/** The total number of vertex shader invocations, i.e. of cache misses */
+		uint32_t mVerticesTransformed = 0;
+	};
+
+	/** Configuration of the steps performed by optimize_mesh */
+	struct mesh_optimization_config
+	{
+		/** Reorder triangles to improve post-transform vertex cache reuse */
+		bool mOptimizeVertexCache = true;
+		/** Additionally reorder clusters of triangles, so that triangles which are likely to occlude others
+		 *	are rendered first. Only takes effect if mOptimizeVertexCache is enabled as well. */
+		bool mOptimizeOverdraw = false;
+		/** How much the ACMR may degrade due to overdraw optimization, e.g. 1.05 means by at most ~5% */
+		float mOverdrawThreshold = 1.05f;
+		/** Reorder vertices in the order in which they are first referenced, to improve vertex fetch locality */
+		bool mOptimizeVertexFetch = true;
+		/** The FIFO cache size which the ACMR/ATVR statistics are computed for */
+		uint32_t mCacheSize = 16;
+	};
+
+	/** The result of optimize_mesh */
+	struct mesh_optimization_result
+	{
+		/** The optimized index buffer. It refers to the reordered vertices if a vertex remap is contained. */
+		std::vector<uint32_t> mIndices;
+		/** Maps each original vertex index to its new index. Vertices which are not referenced by any triangle
+		 *	map to `sUnusedVertex` and are dropped. Empty if vertex fetch optimization has not been performed.
+		 *	Use `remap_vertex_buffer` to apply it to all of the mesh's vertex attribute buffers. */
+		std::vector<uint32_t> mVertexRemap;
+		/** The number of vertices after remapping */
+		size_t mNumVertices = 0;
+		/** Vertex cache statistics of the original index buffer */
+		vertex_cache_statistics mStatisticsBefore;
+		/** Vertex cache statistics of the optimized index buffer */
+		vertex_cache_statistics mStatisticsAfter;
+
+		/** Value in mVertexRemap for vertices which are not referenced */
+		static constexpr uint32_t sUnusedVertex = std::numeric_limits<uint32_t>::max();
+	};
+
+	/** Serialization/deserialization method for vertex_cache_statistics.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, vertex_cache_statistics& aValue)
+	{
+		aArchive(aValue.mAcmr, aValue.mAtvr, aValue.mVerticesTransformed);
+	}
+
+	/** Serialization/deserialization method for mesh_optimization_result.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, mesh_optimization_result& aValue)
+	{
+		aArchive(aValue.mIndices, aValue.mVertexRemap, aValue.mNumVertices, aValue.mStatisticsBefore, aValue.mStatisticsAfter);
+	}
+
+	/** Simulates a FIFO post-transform vertex cache of the given size for the given triangle list.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices which the indices refer to
+	 *	@param	aCacheSize		Number of entries of the simulated cache
+	 */
+	vertex_cache_statistics analyze_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices, uint32_t aCacheSize = 16);
+
+	/** Reorders the triangles of the given triangle list for post-transform vertex cache reuse.
+	 *	This implements Tom Forsyth's "Linear-Speed Vertex Cache Optimisation", which does not depend
+	 *	on a specific cache size.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices which the indices refer to
+	 *	@return	The reordered triangle list, referring to the same vertices
+	 */
+	std::vector<uint32_t> optimize_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices);
+
+	/** Reorders clusters of triangles in order to reduce overdraw, while keeping the vertex cache efficiency
+	 *	within the given threshold. The input should already be optimized for the vertex cache.
+	 *	Clusters are formed along the index buffer wherever the vertex cache would start over anyways, and
+	 *	are sorted such that the clusters which face outwards the most are rendered first (this follows the
+	 *	view-independent approach of Sander et al. "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").
+	 *	@param	aIndices		Triangle list indices, which should have been optimized for the vertex cache
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aThreshold		Permitted ACMR degradation factor, e.g. 1.05
+	 *	@param	aCacheSize		Cache size which is used for determining the cluster boundaries
+	 */
+	std::vector<uint32_t> optimize_overdraw(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, float aThreshold = 1.05f, uint32_t aCacheSize = 16);
+
+	/** Computes a vertex remap table which orders the vertices in the order of their first reference in the index buffer.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aNumVertices	Number of vertices which the indices refer to
+	 *	@return	Tuple of: [0] the remap table (see mesh_optimization_result::mVertexRemap), and [1] the number of referenced vertices
+	 */
+	std::tuple<std::vector<uint32_t>, size_t> optimize_vertex_fetch_remap(const std::vector<uint32_t>& aIndices, size_t aNumVertices);
+
+	/** Applies a vertex remap table to an index buffer.
+	 *	@param	aIndices		Indices which refer to the original vertices
+	 *	@param	aVertexRemap	Remap table as returned by optimize_vertex_fetch_remap or contained in mesh_optimization_result
+	 */
+	std::vector<uint32_t> remap_index_buffer(const std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aVertexRemap);
+
+	/** Applies a vertex remap table to a vertex attribute buffer.
+	 *	@param	aVertices		The original vertex attribute data, e.g. as returned by `get_normals`
+	 *	@param	aVertexRemap	Remap table as returned by optimize_vertex_fetch_remap or contained in mesh_optimization_result
+	 *	@param	aNumVertices	The number of vertices after remapping
+	 */
+	template <typename T>
+	std::vector<T> remap_vertex_buffer(const std::vector<T>& aVertices, const std::vector<uint32_t>& aVertexRemap, size_t aNumVertices)
+	{
+		if (aVertexRemap.empty()) {
+			return aVertices;
+		}
+		if (aVertices.size() != aVertexRemap.size()) {
+			throw avk::runtime_error(fmt::format("The number of vertices ({}) does not match the size of the remap table ({}).", aVertices.size(), aVertexRemap.size()));
+		}
+		std::vector<T> result(aNumVertices);
+		for (size_t i = 0; i < aVertices.size(); ++i) {
+			if (mesh_optimization_result::sUnusedVertex != aVertexRemap[i]) {
+				result[aVertexRemap[i]] = aVertices[i];
+			}
+		}
+		return result;
+	}
+
+	/** Applies the vertex remap table of an optimization result to a vertex attribute buffer.
+	 *	@param	aVertices		The original vertex attribute data, e.g. as returned by `get_normals`
+	 *	@param	aResult			The result of optimize_mesh
+	 */
+	template <typename T>
+	std::vector<T> remap_vertex_buffer(const std::vector<T>& aVertices, const mesh_optimization_result& aResult)
+	{
+		return remap_vertex_buffer(aVertices, aResult.mVertexRemap, aResult.mNumVertices);
+	}
+
+	/** Runs the optimization steps enabled in the given config on a triangle list and reports
+	 *	vertex cache statistics before and after optimization.
+	 *	This can be applied to individual meshes, or to the combined output of `get_vertices_and_indices`.
+	 *	Note that if vertex fetch optimization is enabled, ALL vertex attribute buffers of the mesh must
+	 *	be reordered via `remap_vertex_buffer` before they can be used with the optimized indices.
+	 *	@param	aPositions		Vertex positions. They are only used for overdraw optimization, but
+	 *							also define the number of vertices.
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Which optimization steps to perform
+	 */
+	mesh_optimization_result optimize_mesh(const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const mesh_optimization_config& aConfig = {});
+
+	/** Runs the optimization steps enabled in the given config on the given mesh of a model.
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model
+	 *	@param	aConfig			Which optimization steps to perform
+	 */
+	mesh_optimization_result optimize_mesh(const model_t& aModel, mesh_index_t aMeshIndex, const mesh_optimization_config& aConfig = {});
+
+	/** Runs the optimization steps enabled in the given config on a triangle list, or loads the result from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aPositions		Vertex positions (see optimize_mesh)
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Which optimization steps to perform
+	 */
+	mesh_optimization_result optimize_mesh_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const mesh_optimization_config& aConfig = {});
+
+	/** Runs the optimization steps enabled in the given config on the given mesh of a model, or loads the result from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model
+	 *	@param	aConfig			Which optimization steps to perform
+	 */
+	mesh_optimization_result optimize_mesh_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const mesh_optimization_config& aConfig = {});
+}
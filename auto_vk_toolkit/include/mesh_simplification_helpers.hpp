@@ -0,0 +1,110 @@
+#pragma once
+
+#include "model.hpp"
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** Configuration of generate_lods */
+	struct lod_generation_config
+	{
+		/** Target triangle counts of the LODs, relative to the triangle count of the original mesh, in decreasing order.
+		 *	LOD 0 (i.e. the original mesh) is always generated and must not be listed here. */
+		std::vector<float> mTargetRatios = { 0.5f, 0.25f, 0.125f, 0.0625f };
+		/** Maximum geometric error of a LOD, relative to the extent of the mesh's bounding box. Simplification of a LOD stops
+		 *	as soon as no further edge collapse is possible within this error, even if its target has not been reached. */
+		float mMaxError = 0.05f;
+		/** Weight of differences in vertex normals when prioritizing edge collapses. Zero disables normal awareness. */
+		float mNormalWeight = 0.5f;
+		/** Weight of differences in texture coordinates when prioritizing edge collapses. Zero disables texture coordinate awareness. */
+		float mTexCoordWeight = 1.0f;
+		/** Keep vertices on open borders of the mesh in place */
+		bool mLockBorders = false;
+		/** No further LODs are generated once a LOD would contain more than this fraction of the triangles of the previous LOD */
+		float mMinReduction = 0.95f;
+	};
+
+	/** One level of detail of a mesh */
+	struct mesh_lod
+	{
+		/** Triangle list indices. They refer to the ORIGINAL vertices of the mesh, i.e. all LODs share the same vertex buffers. */
+		std::vector<uint32_t> mIndices;
+		/** The geometric error of this LOD w.r.t. the original mesh, relative to the extent of the mesh's bounding box */
+		float mRelativeError = 0.0f;
+		/** The geometric error of this LOD w.r.t. the original mesh, in units of the mesh's positions (i.e. in object space) */
+		float mError = 0.0f;
+	};
+
+	/** Serialization/deserialization method for mesh_lod.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, mesh_lod& aValue)
+	{
+		aArchive(aValue.mIndices, aValue.mRelativeError, aValue.mError);
+	}
+
+	/** Generates a chain of LODs for a triangle list by iteratively collapsing edges in the order of their costs.
+	 *	The geometric error of a collapse is estimated with quadric error metrics (Garland and Heckbert, "Surface
+	 *	Simplification Using Quadric Error Metrics"); the cost additionally includes the weighted differences of
+	 *	the vertices' normals and texture coordinates, s.t. collapses which preserve the attributes are preferred.
+	 *	Edges are collapsed onto one of their existing vertices, which is why all LODs can share the original vertex buffers.
+	 *	Vertices on attribute seams (i.e. with multiple vertices at the same position, but with different attributes)
+	 *	and on non-manifold edges are kept in place; vertices on open borders may only move along the border.
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aNormals		Vertex normals, or empty to not take normals into account
+	 *	@param	aTexCoords		Vertex texture coordinates, or empty to not take texture coordinates into account
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Target sizes of the LODs and error bounds
+	 *	@return	The LODs, where element [0] always contains the original indices with an error of zero.
+	 *			The LODs are ordered by decreasing triangle count and increasing error. Fewer LODs than
+	 *			requested are returned if the error bounds do not permit further simplification.
+	 */
+	std::vector<mesh_lod> generate_lods(const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords, const std::vector<uint32_t>& aIndices, const lod_generation_config& aConfig = {});
+
+	/** Generates a chain of LODs for the given mesh of a model, taking its normals and its first
+	 *	set of texture coordinates into account. See the other overload for details.
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model
+	 *	@param	aConfig			Target sizes of the LODs and error bounds
+	 */
+	std::vector<mesh_lod> generate_lods(const model_t& aModel, mesh_index_t aMeshIndex, const lod_generation_config& aConfig = {});
+
+	/** Generates a chain of LODs for a triangle list, or loads it from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aPositions		Vertex positions
+	 *	@param	aNormals		Vertex normals, or empty to not take normals into account
+	 *	@param	aTexCoords		Vertex texture coordinates, or empty to not take texture coordinates into account
+	 *	@param	aIndices		Triangle list indices
+	 *	@param	aConfig			Target sizes of the LODs and error bounds
+	 */
+	std::vector<mesh_lod> generate_lods_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords, const std::vector<uint32_t>& aIndices, const lod_generation_config& aConfig = {});
+
+	/** Generates a chain of LODs for the given mesh of a model, or loads it from cache.
+	 *	@param	aSerializer		The serializer which the result is written to or read from
+	 *	@param	aModel			The model
+	 *	@param	aMeshIndex		The index of the mesh within the model
+	 *	@param	aConfig			Target sizes of the LODs and error bounds
+	 */
+	std::vector<mesh_lod> generate_lods_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const lod_generation_config& aConfig = {});
+
+	/** Selects the coarsest LOD whose error does not exceed the given error.
+	 *	@param	aLods			LODs as returned by generate_lods
+	 *	@param	aMaxError		The maximum permitted error in object space. If an instance is scaled,
+	 *							divide the permitted error by the instance's scale.
+	 *	@return	The index of the selected LOD
+	 */
+	size_t select_lod(const std::vector<mesh_lod>& aLods, float aMaxError);
+
+	/** Selects the coarsest LOD whose error, projected onto the screen, does not exceed the given number of pixels.
+	 *	@param	aLods				LODs as returned by generate_lods
+	 *	@param	aDistance			Distance of the instance from the camera, in object space units
+	 *	@param	aVerticalFov		The camera's vertical field of view in radians
+	 *	@param	aViewportHeight		The height of the viewport in pixels
+	 *	@param	aMaxPixelError		The maximum permitted error in pixels
+	 *	@return	The index of the selected LOD
+	 */
+	size_t select_lod(const std::vector<mesh_lod>& aLods, float aDistance, float aVerticalFov, float aViewportHeight, float aMaxPixelError = 1.0f);
+}
@@ -2,6 +2,7 @@
 
 #include "material_image_helpers.hpp"
 #include "serializer.hpp"
+#include "thread_pool.hpp"
 
 namespace avk
 {
@@ -24,6 +25,18 @@ namespace avk
 		uint32_t mVertexCount;
 		/** The actual number of indices in mIndices; */
 		uint32_t mIndexCount;
+		/** Axis-aligned bounding box of the meshlet's vertices.
+		 *  It is computed by divide_indexed_geometry_into_meshlets and refers to the same space as the vertices passed to it.
+		 */
+		bounding_box mBoundingBox;
+		/** Bounding sphere of the meshlet's vertices.
+		 *  It is computed by divide_indexed_geometry_into_meshlets and refers to the same space as the vertices passed to it.
+		 */
+		bounding_sphere mBoundingSphere;
+		/** Cone which bounds the normals of the meshlet's triangles, for backface culling of the whole meshlet.
+		 *  It is computed by divide_indexed_geometry_into_meshlets and refers to the same space as the vertices passed to it.
+		 */
+		normal_cone mNormalCone;
 	};
 
 	/** Meshlet for GPU usage
@@ -57,6 +70,59 @@ namespace avk
 		uint8_t mPrimitiveCount;
 	};
 
+	/** Meshlet for GPU usage in combination with the compact meshlet data generated by convert_for_gpu_usage.
+	 *  The meshlet's data consists of two bit streams, starting at uint32_t element mDataOffset. Values are packed from
+	 *  the least significant bit upwards and may straddle uint32_t boundaries:
+	 *   1) Vertex indices, stored as differences to mVertexBase with mVertexDeltaBits bits each. The number of bits is
+	 *      the smallest one which can represent the meshlet's largest difference. This region occupies
+	 *      ceil(mVertexCount * mVertexDeltaBits / 32) uint32_t values.
+	 *   2) Triangles, stored with 3 * mIndexBits bits per triangle, where mIndexBits is the smallest number of bits which
+	 *      can represent the meshlet's vertex indices, e.g. 6 bits for meshlets with 64 vertices.
+	 *      This region occupies ceil(mPrimitiveCount * 3 * mIndexBits / 32) uint32_t values.
+	 *  Meshlets with more than 255 vertices or triangles can not be represented, since both counts are stored in 8 bits.
+	 *  See examples/skinned_meshlets/shaders/compact_meshlet.glsl for decode functions, which the skinned_meshlets
+	 *  example uses if USE_COMPACT_GPU_DATA is set.
+	 */
+	struct meshlet_compact_gpu_data
+	{
+		/** Data offset into the meshlet data array */
+		uint32_t mDataOffset;
+		/** The smallest vertex index of the meshlet, which the stored vertex indices are relative to */
+		uint32_t mVertexBase;
+		/** The vertex count, at most 255 */
+		uint8_t mVertexCount;
+		/** The primitive count, at most 255 */
+		uint8_t mPrimitiveCount;
+		/** The number of bits per vertex index difference, in the range [1, 32] */
+		uint8_t mVertexDeltaBits;
+		/** The number of bits per triangle corner, in the range [1, 8] */
+		uint8_t mIndexBits;
+	};
+
+	/** Encodes a meshlet into the compact representation and appends its data to the given meshlet data array.
+	 *	@param	aMeshlet		The meshlet to encode
+	 *	@param	aMeshletData	The meshlet data array which the bit-packed vertex indices and triangles are appended to
+	 *	@return	The meshlet's compact representation, which refers to the appended data
+	 *	Throws if the meshlet has more than 255 vertices or more than 255 triangles.
+	 */
+	meshlet_compact_gpu_data encode_compact_meshlet(const meshlet& aMeshlet, std::vector<uint32_t>& aMeshletData);
+
+	/** Per-meshlet culling data for GPU usage, meant to be stored in an array alongside the meshlets returned by
+	 *  convert_for_gpu_usage. The layout is compatible with both std140 and std430.
+	 *  A task shader can skip a meshlet if its bounding sphere lies outside of the view frustum, or if
+	 *		dot(normalize(mConeApex.xyz - cameraPosition), mConeAxisAndCutoff.xyz) >= mConeAxisAndCutoff.w
+	 *  (with all values and the camera position in the same space), because then all of its triangles are back-facing.
+	 */
+	struct meshlet_culling_gpu_data
+	{
+		/** Center of the bounding sphere in xyz, its radius in w */
+		glm::vec4 mBoundingSphere;
+		/** Apex of the normal cone in xyz, w is unused */
+		glm::vec4 mConeApex;
+		/** Axis of the normal cone in xyz, its cutoff in w. A cutoff greater than 1 disables cone culling. */
+		glm::vec4 mConeAxisAndCutoff;
+	};
+
 	/** Serialization/deserialization method for meshlet_gpu_data.
 	 *	@param	aArchive	The archive.
 	 *	@param	aValue		The value to serialize or to deserialize into.
@@ -84,6 +150,28 @@ namespace avk
 	}
 
 
+	/** Serialization/deserialization method for meshlet_compact_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_compact_gpu_data& aValue)
+	{
+		aArchive(aValue.mDataOffset, aValue.mVertexBase, aValue.mVertexCount, aValue.mPrimitiveCount, aValue.mVertexDeltaBits, aValue.mIndexBits);
+	}
+
+	/** Serialization/deserialization method for meshlet_culling_gpu_data.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_culling_gpu_data& aValue)
+	{
+		aArchive(aValue.mBoundingSphere, aValue.mConeApex, aValue.mConeAxisAndCutoff);
+	}
+
 	/** Divides the given index buffer into meshlets by simply aggregating every aMaxVertices indices into a meshlet.
 	 *  @param	aIndices			The index buffer.
 	 *  @param	aModel				The model these buffers belong to.
@@ -97,6 +185,66 @@ namespace avk
 		std::optional<mesh_index_t> aMeshIndex,
 		uint32_t aMaxVertices, uint32_t aMaxIndices);
 
+	/** Divides the given vertex and index buffer into meshlets which share vertices between their triangles.
+	 *  Meshlets are grown greedily along the surface: Among all unassigned triangles which share a vertex with the
+	 *  current meshlet, the one which adds the fewest new vertices is added next; ties are broken by the distance of the
+	 *  triangle's centroid to the meshlet's center, which keeps meshlets compact. If a meshlet can not grow along the
+	 *  surface anymore, it continues with the next unassigned triangle in the Morton order of the triangles' centroids.
+	 *  In contrast to basic_meshlets_divider, every vertex is stored only once per meshlet, i.e. a meshlet of a regular
+	 *  triangle mesh contains roughly half as many vertices as triangles instead of three times as many.
+	 *  To use it, pass it to divide_into_meshlets; its default overload still uses basic_meshlets_divider.
+	 *  @param	aVertices			The vertex buffer.
+	 *  @param	aIndices			The index buffer.
+	 *  @param	aModel				The model these buffers belong to.
+	 *	@param	aMeshIndex			The optional mesh index of the mesh these buffers belong to.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet. Must not exceed 256, since meshlet indices are 8-bit.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 */
+	std::vector<meshlet> locality_meshlets_divider(
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		const model_t& aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices);
+
+	/** Divides the given vertex and index buffer into meshlets with the algorithm of locality_meshlets_divider.
+	 *  In contrast to locality_meshlets_divider, the geometry does not need to belong to a model, e.g. because it
+	 *  has been generated. Neither the model nor the mesh index of the resulting meshlets are set.
+	 *  @param	aVertices			The vertex buffer.
+	 *  @param	aIndices			The index buffer.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet. Must not exceed 256, since meshlet indices are 8-bit.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 */
+	std::vector<meshlet> divide_triangles_into_meshlets(const std::vector<glm::vec3>& aVertices, const std::vector<uint32_t>& aIndices, uint32_t aMaxVertices, uint32_t aMaxIndices);
+
+	/** Statistics about how well meshlets reuse their vertices, as computed by analyze_meshlets. */
+	struct meshlet_statistics
+	{
+		/** The number of meshlets */
+		size_t mNumMeshlets = 0;
+		/** The total number of triangles of all meshlets */
+		size_t mNumTriangles = 0;
+		/** The sum of the vertex counts of all meshlets, i.e. how many vertices a mesh shader has to process */
+		size_t mNumMeshletVertices = 0;
+		/** The number of distinct vertices which are referenced by the meshlets */
+		size_t mNumUniqueVertices = 0;
+		/** The maximum vertex count of a single meshlet */
+		uint32_t mMaxVerticesPerMeshlet = 0;
+		/** The maximum triangle count of a single meshlet */
+		uint32_t mMaxTrianglesPerMeshlet = 0;
+		float mAverageVerticesPerMeshlet = 0.0f;
+		float mAverageTrianglesPerMeshlet = 0.0f;
+		/** Processed vertices per triangle. Without any reuse, this is 3; for regular meshes, it approaches 0.5 with large meshlets. */
+		float mVerticesPerTriangle = 0.0f;
+		/** Processed vertices per distinct vertex, i.e. how often a vertex is processed on average. The optimum is 1. */
+		float mVertexDuplication = 0.0f;
+	};
+
+	/** Computes statistics about the vertex reuse of the given meshlets, e.g. to compare different meshlet dividers.
+	 *	@param	aMeshlets			The meshlets to analyze.
+	 */
+	meshlet_statistics analyze_meshlets(const std::vector<meshlet>& aMeshlets);
+
 	/** Divides the given vertex and index buffer into meshlets using the given callback function.
 	 *  @param	aVertices			The vertex buffer.
 	 *  @param	aIndices			The index buffer.
@@ -151,15 +299,24 @@ namespace avk
 			throw avk::logic_error("No compatible lambda has been passed to divide_into_meshlets.");
 		}
 
+		std::vector<glm::vec3> meshletPositions;
 		for (auto& meshlet : generatedMeshlets)
 		{
 			meshlet.mModel = aModel;
+			meshletPositions.clear();
+			for (uint32_t i = 0; i < meshlet.mVertexCount; ++i) {
+				meshletPositions.push_back(aVertices[meshlet.mVertices[i]]);
+			}
+			meshlet.mBoundingBox = compute_bounding_box(meshletPositions);
+			meshlet.mBoundingSphere = compute_bounding_sphere(meshletPositions);
+			meshlet.mNormalCone = compute_normal_cone(meshletPositions, std::span<const uint8_t>(meshlet.mIndices.data(), meshlet.mIndexCount));
 		}
 
 		return generatedMeshlets;
 	}
 
-	/** Divides the given models into meshlets using the default implementation divide_into_meshlets_simple.
+	/** Divides the given models into meshlets using the default implementation basic_meshlets_divider.
+	 *  For meshlets which reuse vertices, pass locality_meshlets_divider to the overload which takes a callback function.
 	 *  @param	aModelsAndMeshletIndices				All the models and associated meshes that should be divided into meshlets.
 	 *	@param	aCombineSubmeshes	If submeshes should be combined into a single vertex/index buffer.
 	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet.
@@ -169,11 +326,16 @@ namespace avk
 		const bool aCombineSubmeshes = true, const uint32_t aMaxVertices = 64, const uint32_t aMaxIndices = 378);
 
 	/** Divides the given models into meshlets using the given callback function.
+	 *  The models (or, if submeshes are not combined, their meshes) are processed in parallel on thread_pool::shared().
+	 *  The order of the resulting meshlets is deterministic, i.e. it does not depend on the order in which the work completes:
+	 *  Meshlets are ordered by model, then by mesh (if submeshes are not combined), then by the order of aMeshletDivision's result.
+	 *  The models will have shared ownership enabled afterwards, since the resulting meshlets share ownership of them.
 	 *  @param	aModelsAndMeshletIndices				All the models and associated meshes that should be divided into meshlets.
 	 *  @param	aMeshletDivision	Callback used to divide meshes into meshlets with a maximum number of vertices and indices each.
 	 *								It can either receive the vertices and indices or just the indices depending on your specific needs.
 	 *								Additionally it provides the model and an optional mesh index if more data is needed. If no mesh index is provided then the meshes were combined beforehand.
-	 *								Ownership of the model must not be taken within the body of aMeshletDivision. The model will be assigned to each `meshlet` after aMeshletDivision has executed. \n\n
+	 *								Ownership of the model must not be taken within the body of aMeshletDivision. The model will be assigned to each `meshlet` after aMeshletDivision has executed.
+	 *								The callback is invoked concurrently from multiple threads and must therefore not modify shared state without synchronization. \n\n
 	 *								The callback must follow a specific declaration schema, optional parameters can be omitted, but all of them need to be provided in the following order:
 	 *								 - const std::vector<glm::vec3>& tVertices:		optional	The vertices of the mesh or combined meshes of the model
 	 *								 - const std::vector<uint32_t>& tIndices:  		mandatory	The indices of the mesh or combined meshes of the model
@@ -201,28 +363,54 @@ namespace avk
 	std::vector<meshlet> divide_into_meshlets(std::vector<std::tuple<avk::model, std::vector<avk::mesh_index_t>>>& aModelsAndMeshletIndices, F aMeshletDivision,
 		const bool aCombineSubmeshes = true, const uint32_t aMaxVertices = 64, const uint32_t aMaxIndices = 378)
 	{
-		std::vector<meshlet> meshlets;
+		// One job per model if submeshes are combined, one job per mesh otherwise:
+		struct job
+		{
+			avk::model mModel;
+			std::vector<mesh_index_t> mMeshIndices;
+			std::optional<mesh_index_t> mMeshIndex;
+		};
+		std::vector<job> jobs;
 		for (auto& pair : aModelsAndMeshletIndices) {
 			auto& model = std::get<avk::model>(pair);
 			auto& meshIndices = std::get<std::vector<mesh_index_t>>(pair);
-
+			// Each job (and each resulting meshlet) shares ownership of the model:
+			model.enable_shared_ownership();
 			if (aCombineSubmeshes) {
-				auto [vertices, indices] = get_vertices_and_indices(make_model_references_and_mesh_indices_selection(model, meshIndices));
-				std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(model), std::nullopt, aMaxVertices, aMaxIndices, std::move(aMeshletDivision));
-				// append to meshlets
-				meshlets.insert(std::end(meshlets), std::make_move_iterator(std::begin(tmpMeshlets)), std::make_move_iterator(std::end(tmpMeshlets)));
+				jobs.push_back(job{ model, meshIndices, std::nullopt });
 			}
 			else {
 				for (const auto meshIndex : meshIndices) {
-					auto vertices = model.get().positions_for_mesh(meshIndex);
-					auto indices = model.get().indices_for_mesh<uint32_t>(meshIndex);
-					std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(model), meshIndex, aMaxVertices, aMaxIndices, std::move(aMeshletDivision));
-					// append to meshlets
-					meshlets.insert(std::end(meshlets), std::make_move_iterator(std::begin(tmpMeshlets)), std::make_move_iterator(std::end(tmpMeshlets)));
+					jobs.push_back(job{ model, {}, meshIndex });
 				}
 			}
 		}
 
+		// Jobs are processed in parallel, but their results are stored in job order, which keeps the output deterministic:
+		std::vector<std::vector<meshlet>> meshletsPerJob(jobs.size());
+		thread_pool::shared().parallel_for(jobs.size(), [&](size_t i) {
+			auto& j = jobs[i];
+			if (j.mMeshIndex.has_value()) {
+				auto vertices = j.mModel.get().positions_for_mesh(j.mMeshIndex.value());
+				auto indices = j.mModel.get().template indices_for_mesh<uint32_t>(j.mMeshIndex.value());
+				meshletsPerJob[i] = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(j.mModel), j.mMeshIndex, aMaxVertices, aMaxIndices, aMeshletDivision);
+			}
+			else {
+				auto [vertices, indices] = get_vertices_and_indices(make_model_references_and_mesh_indices_selection(j.mModel, j.mMeshIndices));
+				meshletsPerJob[i] = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(j.mModel), std::nullopt, aMaxVertices, aMaxIndices, aMeshletDivision);
+			}
+		});
+
+		// Concatenate the results at precomputed offsets:
+		std::vector<size_t> offsets(meshletsPerJob.size() + 1, 0);
+		for (size_t i = 0; i < meshletsPerJob.size(); ++i) {
+			offsets[i + 1] = offsets[i] + meshletsPerJob[i].size();
+		}
+		std::vector<meshlet> meshlets(offsets.back());
+		thread_pool::shared().parallel_for(meshletsPerJob.size(), [&](size_t i) {
+			std::ranges::move(meshletsPerJob[i], meshlets.begin() + offsets[i]);
+		});
+
 		return meshlets;
 	}
 	
@@ -236,7 +424,7 @@ namespace avk
 	
 	/** Converts meshlets into a GPU usable representation.
 	 *	@param	aMeshlets	The meshlets to convert
-	 *	@tparam	T			Either meshlet_gpu_data or meshlet_redirected_gpu_data.
+	 *	@tparam	T			Either meshlet_gpu_data, meshlet_redirected_gpu_data, or meshlet_compact_gpu_data.
 	 *	                    - meshlet_gpu_data => The output will be one vector of meshlet_gpu_data elements, and the
 	 *	                      second tuple element will be empty.
 	 *	                    - meshlet_redirected_gpu_data => Two vectors are returned: Firstly, a vector of meshlet_redirected_gpu_data elements
@@ -245,6 +433,8 @@ namespace avk
 	 *						   1) The meshlet data contains the vertex indices from [mDataOffset .. mDataOffset+mVertexCount).
 	 *						   2) The indices into the vertex indices, where groups of four uint8_t values are packed into a single uint32_t value.
 	 *						      Region 2 is stored in [mDataOffset+mVertexCount .. mDataOffset+mVertexCount+(mIndexCount+3)/4)
+	 *	                    - meshlet_compact_gpu_data => Like meshlet_redirected_gpu_data, but the meshlet data is bit-packed,
+	 *						  which typically reduces its size by roughly half. For details about the format, see meshlet_compact_gpu_data.
 	 *                      The advantage of the non-redirected representation is easier handling, while the index data must be copied.
 	 *                      The advantage of the redirected representation can be more compressed data, while there is another indirection.
 	 *  @tparam NV			The number of vertices
@@ -252,7 +442,7 @@ namespace avk
 	 *  @returns			A Tuple of the following structure:
 	 *                      <0>: The input meshlets, converted into the provided output meshlet type.
 	 *                           If T is meshlet_redirected_gpu_data, it will contain offsets into the second tuple element:
-	 *                      <1>: Meshlet indices data, if the redirected representation is used. (For more details, see description of T.)
+	 *                      <1>: Meshlet indices data, if the redirected or compact representation is used. (For more details, see description of T.)
 	 */
 	template <typename T, size_t NV, size_t NI>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
@@ -279,10 +469,17 @@ namespace avk
 				ml.mDataOffset = vertexIndices->size();
 				// copy vertex indices
 				vertexIndices->insert(vertexIndices->end(), meshlet.mVertices.begin(), meshlet.mVertices.end());
-				// pack indices
-				const uint32_t* indexGroups = reinterpret_cast<const uint32_t*>(meshlet.mIndices.data());
+				// pack indices, four per uint32_t (the last group is padded with zeros):
 				const uint32_t indexGroupCount = (meshlet.mIndexCount + 3) / 4;
-				vertexIndices->insert(vertexIndices->end(), indexGroups, indexGroups + indexGroupCount);
+				const auto groupsBegin = vertexIndices->size();
+				vertexIndices->resize(groupsBegin + indexGroupCount, 0u);
+				std::memcpy(vertexIndices->data() + groupsBegin, meshlet.mIndices.data(), meshlet.mIndexCount * sizeof(uint8_t));
+			}
+			else if constexpr (std::is_convertible_v<T, meshlet_compact_gpu_data>) {
+				if (!vertexIndices.has_value()) {
+					vertexIndices = std::vector<uint32_t>();
+				}
+				static_cast<meshlet_compact_gpu_data&>(newEntry) = encode_compact_meshlet(meshlet, vertexIndices.value());
 			}
 			else {
 				assert(false);
@@ -294,7 +491,7 @@ namespace avk
 
 	/** Converts meshlets into a GPU usable representation.
 	 *	@param	aMeshlets	The meshlets to convert
-	 *	@tparam	T			Either meshlet_gpu_data or meshlet_redirected_gpu_data.
+	 *	@tparam	T			Either meshlet_gpu_data, meshlet_redirected_gpu_data, or meshlet_compact_gpu_data.
 	 *	                    - meshlet_gpu_data => The output will be one vector of meshlet_gpu_data elements, and the
 	 *	                      second tuple element will be empty.
 	 *	                    - meshlet_redirected_gpu_data => Two vectors are returned: Firstly, a vector of meshlet_redirected_gpu_data elements
@@ -303,12 +500,14 @@ namespace avk
 	 *						   1) The meshlet data contains the vertex indices from [mDataOffset .. mDataOffset+mVertexCount).
 	 *						   2) The indices into the vertex indices, where groups of four uint8_t values are packed into a single uint32_t value.
 	 *						      Region 2 is stored in [mDataOffset+mVertexCount .. mDataOffset+mVertexCount+(mIndexCount+3)/4)
+	 *	                    - meshlet_compact_gpu_data => Like meshlet_redirected_gpu_data, but the meshlet data is bit-packed,
+	 *						  which typically reduces its size by roughly half. For details about the format, see meshlet_compact_gpu_data.
 	 *                      The advantage of the non-redirected representation is easier handling, while the index data must be copied.
 	 *                      The advantage of the redirected representation can be more compressed data, while there is another indirection.
 	 *  @returns			A Tuple of the following structure:
 	 *                      <0>: The input meshlets, converted into the provided output meshlet type.
 	 *                           If T is meshlet_redirected_gpu_data, it will contain offsets into the second tuple element:
-	 *                      <1>: Meshlet indices data, if the redirected representation is used. (For more details, see description of T.)
+	 *                      <1>: Meshlet indices data, if the redirected or compact representation is used. (For more details, see description of T.)
 	 */
 	template <typename T> requires has_static_num_vertices_and_num_indices<T>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
@@ -316,10 +515,23 @@ namespace avk
 		return convert_for_gpu_usage<T, T::sNumVertices, T::sNumIndices>(aMeshlets);
 	}
 
+	/** Converts meshlets into the redirected or compact GPU representation.
+	 *  The layouts of these representations do not depend on the maximum numbers of vertices and indices of a meshlet,
+	 *  i.e. all meshlets are converted as they are. See the overload with the NV and NI template parameters for details.
+	 *	@param	aMeshlets	The meshlets to convert
+	 *	@tparam	T			Either meshlet_redirected_gpu_data or meshlet_compact_gpu_data.
+	 */
+	template <typename T> requires (std::is_convertible_v<T, meshlet_redirected_gpu_data> || std::is_convertible_v<T, meshlet_compact_gpu_data>)
+	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
+	{
+		// NV and NI are only used for meshlet_gpu_data:
+		return convert_for_gpu_usage<T, meshlet_gpu_data<>::sNumVertices, meshlet_gpu_data<>::sNumIndices>(aMeshlets);
+	}
+
 	/** Converts meshlets into a GPU usable representation.
 	 *  @param  aSerializer The serializer for the meshlet gpu data.
 	 *	@param	aMeshlets	The meshlets to convert
-	 *	@tparam	T			Either meshlet_gpu_data or meshlet_redirected_gpu_data.
+	 *	@tparam	T			Either meshlet_gpu_data, meshlet_redirected_gpu_data, or meshlet_compact_gpu_data.
 	 *	                    - meshlet_gpu_data => The output will be one vector of meshlet_gpu_data elements, and the
 	 *	                      second tuple element will be empty.
 	 *	                    - meshlet_redirected_gpu_data => Two vectors are returned: Firstly, a vector of meshlet_redirected_gpu_data elements
@@ -328,6 +540,8 @@ namespace avk
 	 *						   1) The meshlet data contains the vertex indices from [mDataOffset .. mDataOffset+mVertexCount).
 	 *						   2) The indices into the vertex indices, where groups of four uint8_t values are packed into a single uint32_t value.
 	 *						      Region 2 is stored in [mDataOffset+mVertexCount .. mDataOffset+mVertexCount+(mIndexCount+3)/4)
+	 *	                    - meshlet_compact_gpu_data => Like meshlet_redirected_gpu_data, but the meshlet data is bit-packed,
+	 *						  which typically reduces its size by roughly half. For details about the format, see meshlet_compact_gpu_data.
 	 *                      The advantage of the non-redirected representation is easier handling, while the index data must be copied.
 	 *                      The advantage of the redirected representation can be more compressed data, while there is another indirection.
 	 *  @tparam NV			The number of vertices
@@ -335,7 +549,7 @@ namespace avk
 	 *  @returns			A Tuple of the following structure:
 	 *                      <0>: The input meshlets, converted into the provided output meshlet type.
 	 *                           If T is meshlet_redirected_gpu_data, it will contain offsets into the second tuple element:
-	 *                      <1>: Meshlet indices data, if the redirected representation is used. (For more details, see description of T.)
+	 *                      <1>: Meshlet indices data, if the redirected or compact representation is used. (For more details, see description of T.)
 	 */
 	template <typename T, size_t NV, size_t NI>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets)
@@ -352,7 +566,7 @@ namespace avk
 		{
 			aSerializer.archive(resultMeshlets);
 		}
-		else if constexpr (std::is_convertible_v<T, meshlet_redirected_gpu_data>)
+		else if constexpr (std::is_convertible_v<T, meshlet_redirected_gpu_data> || std::is_convertible_v<T, meshlet_compact_gpu_data>)
 		{
 			aSerializer.archive(resultMeshlets);
 			aSerializer.archive(resultMeshletsData);
@@ -367,7 +581,7 @@ namespace avk
 	/** Converts meshlets into a GPU usable representation.
 	 *  @param  aSerializer The serializer for the meshlet gpu data.
 	 *	@param	aMeshlets	The meshlets to convert
-	 *	@tparam	T			Either meshlet_gpu_data or meshlet_redirected_gpu_data.
+	 *	@tparam	T			Either meshlet_gpu_data, meshlet_redirected_gpu_data, or meshlet_compact_gpu_data.
 	 *	                    - meshlet_gpu_data => The output will be one vector of meshlet_gpu_data elements, and the
 	 *	                      second tuple element will be empty.
 	 *	                    - meshlet_redirected_gpu_data => Two vectors are returned: Firstly, a vector of meshlet_redirected_gpu_data elements
@@ -376,12 +590,14 @@ namespace avk
 	 *						   1) The meshlet data contains the vertex indices from [mDataOffset .. mDataOffset+mVertexCount).
 	 *						   2) The indices into the vertex indices, where groups of four uint8_t values are packed into a single uint32_t value.
 	 *						      Region 2 is stored in [mDataOffset+mVertexCount .. mDataOffset+mVertexCount+(mIndexCount+3)/4)
+	 *	                    - meshlet_compact_gpu_data => Like meshlet_redirected_gpu_data, but the meshlet data is bit-packed,
+	 *						  which typically reduces its size by roughly half. For details about the format, see meshlet_compact_gpu_data.
 	 *						The advantage of the non-redirected representation is easier handling, while the index data must be copied.
 	 *                      The advantage of the redirected representation can be more compressed data, while there is another indirection.
 	 *  @returns			A Tuple of the following structure:
 	 *                      <0>: The input meshlets, converted into the provided output meshlet type.
 	 *                           If T is meshlet_redirected_gpu_data, it will contain offsets into the second tuple element:
-	 *                      <1>: Meshlet indices data, if the redirected representation is used. (For more details, see description of T.)
+	 *                      <1>: Meshlet indices data, if the redirected or compact representation is used. (For more details, see description of T.)
 	 */
 	template <typename T> requires has_static_num_vertices_and_num_indices<T>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets)
@@ -389,4 +605,29 @@ namespace avk
 		return convert_for_gpu_usage_cached<T, T::sNumVertices, T::sNumIndices>(aSerializer, aMeshlets);
 	}
 
+	/** Converts the bounding volumes of meshlets into a GPU usable representation.
+	 *	The result contains one entry per meshlet, in the same order as the meshlets which convert_for_gpu_usage returns,
+	 *	i.e. the bounding volumes of a meshlet_gpu_data or meshlet_redirected_gpu_data element can be looked up with the same index.
+	 *	@param	aMeshlets	The meshlets whose bounding volumes to convert
+	 */
+	std::vector<bounding_volume_gpu_data> convert_bounding_volumes_for_gpu_usage(const std::vector<meshlet>& aMeshlets);
+
+	/** Converts the bounding volumes of meshlets into a GPU usable representation.
+	 *  @param  aSerializer The serializer for the bounding volumes.
+	 *	@param	aMeshlets	The meshlets whose bounding volumes to convert
+	 */
+	std::vector<bounding_volume_gpu_data> convert_bounding_volumes_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets);
+
+	/** Converts the culling data of meshlets, i.e. their bounding spheres and normal cones, into a GPU usable representation.
+	 *	The result contains one entry per meshlet, in the same order as the meshlets which convert_for_gpu_usage returns.
+	 *	@param	aMeshlets	The meshlets whose culling data to convert
+	 */
+	std::vector<meshlet_culling_gpu_data> convert_culling_data_for_gpu_usage(const std::vector<meshlet>& aMeshlets);
+
+	/** Converts the culling data of meshlets into a GPU usable representation, or loads it from cache.
+	 *  @param  aSerializer The serializer for the culling data.
+	 *	@param	aMeshlets	The meshlets whose culling data to convert
+	 */
+	std::vector<meshlet_culling_gpu_data> convert_culling_data_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets);
+
 }
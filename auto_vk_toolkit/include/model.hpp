@@ -1,12 +1,36 @@
 #pragma once
 
-#include "animation.hpp"
+#include "packed_animation.hpp"
+#include "bounding_volumes.hpp"
 #include "camera.hpp"
 #include "lightsource.hpp"
 #include "material_config.hpp"
 
 namespace avk
 {
+	/** An entry of a model's flattened node hierarchy.
+	 *	All entries are stored in topological order, i.e. a parent node
+	 *	is always stored at a lower index than any of its children.
+	 */
+	struct model_node
+	{
+		/** Pointer to the corresponding node in Assimp's node hierarchy */
+		aiNode* mNode;
+		/** Index of the parent node in the flattened hierarchy, or no value for the root node */
+		std::optional<size_t> mParentIndex;
+		/** Accumulated transformation matrix from the root node down to this node */
+		glm::mat4 mGlobalTransform;
+		/** Axis-aligned bounding box of all the meshes of this node and of its descendants, in model space */
+		bounding_box mBoundingBox;
+		/** Bounding sphere of all the meshes of this node and of its descendants, in model space */
+		bounding_sphere mBoundingSphere;
+	};
+
+	/** Callback which is invoked with the current loading progress in the range [0, 1].
+	 *	Note: When loading asynchronously, it is invoked from a worker thread.
+	 */
+	using load_progress_callback = std::function<void(float)>;
+
 	class model_t
 	{
 		friend class context_vulkan;
@@ -23,10 +47,42 @@ namespace avk
 
 		const auto* handle() const { return mScene; }
 
-		static avk::owning_resource<model_t> load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
+		/** Loads a model from file.
+		 *	@param	aPath				Path to the model file
+		 *	@param	aAssimpFlags		Assimp post-processing flags
+		 *	@param	aProgressCallback	Optional callback which is informed about the loading progress
+		 */
+		static avk::owning_resource<model_t> load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, load_progress_callback aProgressCallback = {});
+
+		/** Loads a model from file on a thread of the shared thread pool (see `thread_pool::shared()`).
+		 *	Parameters are the same as for `load_from_file`.
+		 *	@return	A future to the loaded model. If loading fails, the exception is rethrown by its `get()`.
+		 *			Do not block on it from within a task that runs on the shared thread pool.
+		 */
+		static std::future<avk::owning_resource<model_t>> load_from_file_async(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, load_progress_callback aProgressCallback = {});
 		
 		static avk::owning_resource<model_t> load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
 
+		/** Loads a model from file and keeps a baked binary representation of the imported (and post-processed)
+		 *	scene next to it. On subsequent loads, the baked file is read directly, which skips parsing the source
+		 *	format and Assimp's post-processing steps entirely.
+		 *	The baked file is keyed on the Assimp flags and on the size and modification time of every file which
+		 *	the importer has opened (e.g., a .gltf file and its .bin buffers, or an .obj file and its .mtl file).
+		 *	Checking whether it is up to date therefore does not read any of the source files' contents. If the key
+		 *	does not match, or if the baked file can not be read, the model is imported from the source files again
+		 *	and the baked file is rewritten.
+		 *	The scene is stored in Assimp's binary format (assbin), behind a header written via `avk::serializer`.
+		 *	assbin round-trips everything that model_t exposes: the node hierarchy, meshes with all their vertex
+		 *	streams and bones, materials, node animations, embedded textures, lights, and cameras. It does not store
+		 *	scene-level metadata nor mesh and morph mesh animation channels, i.e., they are missing from baked models.
+		 *	The returned model behaves exactly like one that has been loaded via `load_from_file`; in particular,
+		 *	`path()` returns the source file's path, so that texture paths are resolved relative to it.
+		 *	@param	aPath			Path to the source model file
+		 *	@param	aAssimpFlags	Assimp post-processing flags that are applied when (re-)importing the source file
+		 *	@param	aBakedPath		Path to the baked file. If not set, ".avkbake" is appended to aPath.
+		 */
+		static avk::owning_resource<model_t> load_from_file_baked(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, std::optional<std::string> aBakedPath = {});
+
 		/** Returns this model's path where it has been loaded from */
 		auto path() const { return mModelPath; }
 
@@ -41,6 +97,21 @@ namespace avk
 		 */
 		glm::mat4 mesh_root_matrix(mesh_index_t aMeshIndex) const;
 
+		/** Gets the axis-aligned bounding box of the mesh at the given index.
+		 *	It is computed once when the model is loaded, and it refers to the mesh's own
+		 *	coordinate space, i.e. to the positions which `positions_for_mesh` returns.
+		 *	Use `transformed` with `transformation_matrix_for_mesh` to get it in model space.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		const bounding_box& bounding_box_for_mesh(mesh_index_t aMeshIndex) const { return mMeshBoundingBoxes[aMeshIndex]; }
+
+		/** Gets the bounding sphere of the mesh at the given index.
+		 *	Like `bounding_box_for_mesh`, it is computed once when the model is loaded
+		 *	and it refers to the mesh's own coordinate space.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		const bounding_sphere& bounding_sphere_for_mesh(mesh_index_t aMeshIndex) const { return mMeshBoundingSpheres[aMeshIndex]; }
+
 		/**	Gets the actual number of bones that are associated to the given mesh index.
 		 *	This number corresponds exactly to what ASSIMP's data structure reflects.
 		 */
@@ -199,6 +270,31 @@ namespace avk
 		 */
 		std::vector<glm::uvec4> bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset = 0) const;
 
+		/** Writes the bone weights AND the bone indices for the mesh at the given index into caller-provided memory.
+		 *	Both are gathered in one single pass over the mesh's bones, selecting the four most influential
+		 *	bones per vertex without any per-vertex allocations. The values written are exactly those
+		 *	which `bone_weights_for_mesh` and `bone_indices_for_mesh` return.
+		 *	@param		aMeshIndex				The index corresponding to the mesh
+		 *	@param		aWeightsDestination		Destination for the bone weights with space for at least `number_of_vertices_for_mesh()`
+		 *										elements. Pass an empty span if no bone weights are required.
+		 *	@param		aIndicesDestination		Destination for the bone indices with space for at least `number_of_vertices_for_mesh()`
+		 *										elements. Pass an empty span if no bone indices are required.
+		 *  @param      aNormalizeBoneWeights	Normalize the weights, so they add up to one
+		 *	@param		aBoneIndexOffset		An offset to be added to every single bone index, like, e.g., the offset for
+		 *										a single target buffer (see `bone_indices_for_mesh_for_single_target_buffer`).
+		 *	@param		aLogWarnings			Log warnings about a mesh without bones or with non-normalized bone weights.
+		 *										Pass false when calling this from worker threads, and log from the calling thread instead.
+		 *	@return		True if the bone weights of any vertex add up to more than 1.001. This is only determined if
+		 *				the bone weights are written and normalized.
+		 */
+		bool write_bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, std::span<glm::vec4> aWeightsDestination, std::span<glm::uvec4> aIndicesDestination, bool aNormalizeBoneWeights = false, uint32_t aBoneIndexOffset = 0, bool aLogWarnings = true) const;
+
+		/** Gets the bone weights AND the bone indices for the mesh at the given index, gathered in one single pass.
+		 *	See `write_bone_weights_and_indices_for_mesh` for the parameters.
+		 *	@return		Tuple of the bone weights and the bone indices, both of length `number_of_vertices_for_mesh()`
+		 */
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights = false, uint32_t aBoneIndexOffset = 0) const;
+
 		/** Gets unique "mesh-set-global" bone indices for the mesh at the given index w.r.t. the given set of mesh indices.
 		 *	If the mesh has no bone indices, a vector filled with values is returned regardless.
 		 *
@@ -364,12 +460,58 @@ namespace avk
 			return result;
 		}
 
+		/** Gets the accumulated number of vertices of all the given meshes.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 */
+		size_t number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/** Writes the vertex data of all the given meshes directly into caller-provided memory, like, e.g.,
+		 *	a mapped staging buffer. Each `aiMesh` is visited once and no intermediate allocations are made.
+		 *	The vertices of the meshes are written consecutively in the order of `aMeshIndices`.
+		 *	Whether the data ends up interleaved or de-interleaved depends solely on `aLayout`, see
+		 *	`make_interleaved_vertex_layout` and `make_deinterleaved_vertex_layout`.
+		 *	Attributes which a mesh does not have are filled with the same default values that the
+		 *	respective `*_for_mesh` getters return.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 *	@param		aLayout			Which attributes to write and where to write them to
+		 *	@param		aDestination	The memory to write into. An exception is thrown if it is too small.
+		 *	@param		aFirstVertex	Destination vertex index where the first vertex of the first mesh is written to
+		 *	@param		aLogMissingAttributes	Log a warning for every attribute which a mesh does not have. Pass false when
+		 *										calling this from worker threads, and call `log_missing_vertex_attributes` from
+		 *										the calling thread instead.
+		 *	@return		The number of vertices written, which is `number_of_vertices_for_meshes(aMeshIndices)`
+		 */
+		size_t write_vertex_data(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<vertex_attribute_layout>& aLayout, std::span<std::byte> aDestination, size_t aFirstVertex = 0, bool aLogMissingAttributes = true) const;
+
+		/**	Logs a warning for every attribute of the given layout which one of the given meshes does not have,
+		 *	i.e. for which `write_vertex_data` writes default values.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 *	@param		aLayout			The attributes to check
+		 */
+		void log_missing_vertex_attributes(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<vertex_attribute_layout>& aLayout) const;
+
 		/** Returns all lightsources stored in the model file */
 		std::vector<lightsource> lights() const;
 
 		/** Returns all cameras stored in the model file */
 		std::vector<avk::camera> cameras() const;
 
+		/** Returns the model's flattened node hierarchy, ordered such that parents come before their children. */
+		const std::vector<model_node>& nodes() const { return mNodes; }
+
+		/** Gets the index into `nodes()` of the node with the given name.
+		 *	If multiple nodes share the same name, the index of the last one (in hierarchy order) is returned.
+		 *	@param		aNodeName		The name of the node to look up
+		 *	@return		The node index, or no value if there is no node with the given name.
+		 */
+		std::optional<size_t> node_index_for_name(const std::string& aNodeName) const;
+
+		/** Gets the index into `nodes()` of the (first) node which references the mesh at the given index.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@return		The node index, or no value if the mesh is not referenced by any node.
+		 */
+		std::optional<size_t> node_index_for_mesh(mesh_index_t aMeshIndex) const;
+
 		/** Load an animation clip's data */
 		animation_clip_data load_animation_clip(unsigned int aAnimationIndex, double aStartTimeTicks, double aEndTimeTicks) const;
 
@@ -381,18 +523,40 @@ namespace avk
 		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animation.
 		 */
 		animation prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices);
+
+		/**	Prepare an animation data structure for the given animation clip and the given mesh indices, whose nodes
+		 *	are classified w.r.t. the clip, see animation::classify_nodes. Nodes which do not change during the clip
+		 *	are skipped during animation, but the resulting animation can only be played with the given clip.
+		 *
+		 *	@param	aClip						The animation clip which the animation will be played with
+		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animation.
+		 */
+		animation prepare_animation(const animation_clip_data& aClip, const std::vector<mesh_index_t>& aMeshIndices);
+
+		/**	Prepare a packed animation data structure for the given animation index and the given mesh indices.
+		 *	It contains the same data as the result of prepare_animation, but laid out for fast evaluation.
+		 *	See packed_animation for details.
+		 *
+		 *	@param	aAnimationIndex				The animation index to create the animation data for
+		 *	@param	aMeshIndices				Vector of mesh indices to meshes which shall be included in the animation.
+		 */
+		packed_animation prepare_packed_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices);
 		
 	private:
 		void initialize_materials();
-		aiNode* find_mesh_root_node(unsigned int aMeshIndexToFind) const;
-		aiNode* mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const;
-		std::optional<glm::mat4> transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* Node, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const;
 
-		/** Helper function which adds the given node and all its child nodes to the given map
+		/** Flattens Assimp's node hierarchy into mNodes and builds all the lookup
+		 *	tables (by name, by mesh, by light, by camera) which refer into it.
+		 *	Must be invoked once after the scene has been loaded.
 		 */
-		void add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode);
+		void initialize_node_hierarchy();
+
+		/** Computes the bounding volumes of all meshes and nodes.
+		 *	Must be invoked once after the node hierarchy has been initialized.
+		 */
+		void initialize_bounding_volumes();
+
+		aiNode* find_mesh_root_node(unsigned int aMeshIndexToFind) const;
 
 						
 		/** Helper function return true if the two given collections have the same size and
@@ -414,10 +578,26 @@ namespace avk
 			return true;
 		}
 
+		/** Writes this model's scene in baked form to the given path, keyed on the given source files and flags.
+		 *	The file is written to a temporary file next to aBakedPath first, whose name is unique per writer, and then renamed to aBakedPath.
+		 *	The temporary file is removed if writing or renaming fails.
+		 */
+		bool write_baked(const std::string& aBakedPath, const std::vector<std::string>& aSourceFiles, aiProcessFlagsType aAssimpFlags) const;
+
 		std::unique_ptr<Assimp::Importer> mImporter;
 		std::string mModelPath;
 		const aiScene* mScene;
 		std::vector<std::optional<material_config>> mMaterialConfigPerMesh;
+
+		// Flattened node hierarchy and lookup tables into it:
+		std::vector<model_node> mNodes;
+		std::unordered_map<std::string, size_t> mNodeIndexForName;
+		std::vector<std::optional<size_t>> mNodeIndexForMesh;
+		std::vector<std::optional<size_t>> mNodeIndexForLight;
+		std::vector<std::optional<size_t>> mNodeIndexForCamera;
+
+		std::vector<bounding_box> mMeshBoundingBoxes;
+		std::vector<bounding_sphere> mMeshBoundingSpheres;
 	};
 
 	using model = avk::owning_resource<model_t>;
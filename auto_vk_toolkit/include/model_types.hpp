@@ -5,6 +5,85 @@ namespace avk
 	using model_index_t = size_t;
 	using mesh_index_t = size_t;
 
+	/** Vertex attributes which can be written by `model_t::write_vertex_data`.
+	 *	The comments state the data type which is written for each attribute.
+	 */
+	enum struct vertex_attribute
+	{
+		position,				// glm::vec3
+		normal,					// glm::vec3, (0,0,1) if the mesh has no normals
+		tangent,				// glm::vec3, (1,0,0) if the mesh has no tangents
+		bitangent,				// glm::vec3, (0,1,0) if the mesh has no bitangents
+		color,					// glm::vec4, opaque magenta if the mesh has no colors for the given set
+		texture_coordinates_2d,	// glm::vec2, (0,0) if the mesh has no texture coordinates for the given set
+		texture_coordinates_3d	// glm::vec3, (0,0,0) if the mesh has no texture coordinates for the given set
+	};
+
+	/** Describes where and how one vertex attribute is to be written to by `model_t::write_vertex_data`.
+	 *	The attribute of the vertex with index i is written to the byte offset `mOffset + i * mStride`.
+	 *	This can describe interleaved layouts (same stride for all attributes, offsets within one vertex)
+	 *	as well as de-interleaved layouts (stride == attribute size, offsets to the start of each block).
+	 */
+	struct vertex_attribute_layout
+	{
+		vertex_attribute mAttribute;
+		/** The color set or texture coordinates set. Ignored for all other attributes. */
+		int mSet = 0;
+		/** Byte offset of the first vertex' attribute in the destination memory */
+		size_t mOffset = 0;
+		/** Byte distance between two consecutive vertices' attributes in the destination memory */
+		size_t mStride = 0;
+	};
+
+	/** Gets the size in bytes of the data type that is written for the given vertex attribute */
+	static size_t size_of(vertex_attribute aAttribute)
+	{
+		switch (aAttribute) {
+		case vertex_attribute::color:
+			return sizeof(glm::vec4);
+		case vertex_attribute::texture_coordinates_2d:
+			return sizeof(glm::vec2);
+		default:
+			return sizeof(glm::vec3);
+		}
+	}
+
+	/** Creates an interleaved vertex layout for the given attributes and sets, where the attributes
+	 *	are tightly packed in the given order. All entries get the same stride, namely the vertex size.
+	 *	@param	aAttributes		Attributes and their (color or texture coordinates) set indices
+	 */
+	static std::vector<vertex_attribute_layout> make_interleaved_vertex_layout(std::vector<std::tuple<vertex_attribute, int>> aAttributes)
+	{
+		std::vector<vertex_attribute_layout> result;
+		result.reserve(aAttributes.size());
+		size_t offset = 0;
+		for (const auto& [attribute, set] : aAttributes) {
+			result.push_back(vertex_attribute_layout{ attribute, set, offset, 0 });
+			offset += size_of(attribute);
+		}
+		for (auto& entry : result) {
+			entry.mStride = offset;
+		}
+		return result;
+	}
+
+	/** Creates a de-interleaved vertex layout for the given attributes and sets, where the data of
+	 *	each attribute is stored in a tightly packed block after the previous attribute's block.
+	 *	@param	aAttributes		Attributes and their (color or texture coordinates) set indices
+	 *	@param	aVertexCount	The total number of vertices that will be written, i.e. the number of elements per block
+	 */
+	static std::vector<vertex_attribute_layout> make_deinterleaved_vertex_layout(std::vector<std::tuple<vertex_attribute, int>> aAttributes, size_t aVertexCount)
+	{
+		std::vector<vertex_attribute_layout> result;
+		result.reserve(aAttributes.size());
+		size_t offset = 0;
+		for (const auto& [attribute, set] : aAttributes) {
+			result.push_back(vertex_attribute_layout{ attribute, set, offset, size_of(attribute) });
+			offset += size_of(attribute) * aVertexCount;
+		}
+		return result;
+	}
+
 	/** Convert from an ASSIMP vec3 to a GLM vec3 */
 	static glm::vec3 to_vec3(const aiVector3D& aAssimpVector)
 	{
@@ -135,7 +135,21 @@ namespace avk
 		 */
 		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> distinct_material_configs_for_all_models(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false);
 
-		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices);
+		/** Loads an ORCA scene from file, including all the models it refers to.
+		 *	The models are imported concurrently on the shared thread pool (see `thread_pool::shared()`).
+		 *	@param	aPath				Path to the ORCA scene file
+		 *	@param	aAssimpFlags		Assimp post-processing flags which are used for each model
+		 *	@param	aProgressCallback	Optional callback which is informed about the loading progress across all models.
+		 *								Note: It is invoked from multiple threads, but never concurrently.
+		 */
+		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, load_progress_callback aProgressCallback = {});
+
+		/** Loads an ORCA scene from file on a thread of the shared thread pool (see `thread_pool::shared()`).
+		 *	Parameters are the same as for `load_from_file`.
+		 *	@return	A future to the loaded scene. If loading fails, the exception is rethrown by its `get()`.
+		 *			Do not block on it from within a task that runs on the shared thread pool.
+		 */
+		static std::future<avk::owning_resource<orca_scene_t>> load_from_file_async(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, load_progress_callback aProgressCallback = {});
 
 	private:
 		std::string mLoadPath;
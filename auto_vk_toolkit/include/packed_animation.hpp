@@ -0,0 +1,364 @@
+#pragma once
+
+#include "animation.hpp"
+#include "thread_pool.hpp"
+
+namespace avk
+{
+	struct packed_animation_gpu_data;
+
+	/**	Local transforms of all nodes of a packed_animation, in the node order of the packed_animation.
+	 *	A pose is the result of sampling an animation clip (see packed_animation::sample_local_pose), which can be
+	 *	blended with other poses, before its global transforms and bone matrices are computed (see packed_animation::compose).
+	 *	Poses of different packed_animations can only be combined if the animations have the same layout,
+	 *	see packed_animation::has_same_layout.
+	 */
+	struct animation_pose
+	{
+		std::vector<glm::vec3> mTranslations;
+		std::vector<glm::quat> mRotations;
+		std::vector<glm::vec3> mScales;
+	};
+
+	/**	Evaluation state of one instance of a packed_animation, i.e. everything that changes during evaluation.
+	 *	Keeping it separate from the packed_animation allows to evaluate multiple instances of the same
+	 *	animation concurrently, each at its own animation time. Use packed_animation::create_state to create one.
+	 */
+	struct packed_animation_state
+	{
+		/** Per node: Positions of the keys found by the most recent lookups for translation, rotation, and scaling */
+		std::vector<uint32_t> mTranslationCursors;
+		std::vector<uint32_t> mRotationCursors;
+		std::vector<uint32_t> mScalingCursors;
+
+		/** Per node: Results of the most recent evaluation */
+		std::vector<glm::mat4> mGlobalTransforms;
+
+		/** The local pose which is sampled by packed_animation::evaluate */
+		animation_pose mLocalPose;
+	};
+
+	/** Storage formats of the key values of a packed_animation */
+	enum struct animation_key_format
+	{
+		/** Translations, rotations, and scalings are stored with full float precision. */
+		full_precision,
+
+		/** Translations and scalings are stored with 16 bits per component, relative to the value range of each
+		 *	node's key collection. Rotations are stored with 48 bits in the smallest-three encoding, i.e. the
+		 *	largest component is omitted, and the other three are stored with 15 bits each. */
+		quantized,
+	};
+
+	/**	Structure-of-arrays representation of an animation, which is laid out for evaluation performance.
+	 *	In contrast to animation, which stores separate vectors of keys and several matrices per animated_node,
+	 *	 - the keys of all nodes are pooled in contiguous arrays, with key times (as float) and key values stored separately,
+	 *	 - nodes are stored in parent-before-child order, so that all global transforms are computed in one pass,
+	 *	 - the local transforms of L nodes at a time are interpolated and composed in lanes which compilers can vectorize, and
+	 *	 - bone matrices are written to their target memory directly, without invoking a callback per bone.
+	 *	Key lookups start at the keys which have been found by the previous lookups (like animation does with its
+	 *	animated_node_key_cursors), i.e. they are O(1) while the animation time advances monotonically.
+	 *	These cursors and the computed transforms are stored in a packed_animation_state. The const methods which take one
+	 *	never modify the packed_animation, so that many instances of it can be evaluated concurrently.
+	 */
+	class packed_animation
+	{
+	public:
+		/** Number of nodes which are evaluated at once if no other value is specified */
+		static constexpr size_t sDefaultLanes = 4;
+
+		packed_animation() = default;
+
+		/**	Creates the packed representation of the given animation.
+		 *	@param	aAnimation		The animation, as created by model_t::prepare_animation. Consider to reduce its keys
+		 *							with animation::reduce_keys before.
+		 *	@param	aKeyFormat		The format in which the key values are stored
+		 */
+		explicit packed_animation(const animation& aAnimation, animation_key_format aKeyFormat = animation_key_format::full_precision);
+
+		/**	Creates an evaluation state for this animation, which can be passed to the const evaluation methods. */
+		packed_animation_state create_state() const;
+
+		/**	Creates a pose for this animation in which all local transforms are the identity. */
+		animation_pose create_pose() const;
+
+		/**	Samples the local transforms of all nodes at the given animation time (in ticks), which is the first
+		 *	stage of evaluate. The resulting pose can be modified (e.g. blended with other poses) before it is
+		 *	passed to compose, which is the second stage. Nodes without keys always get the identity transform,
+		 *	because their constant local transform is part of their parent transform.
+		 *	@param	aTimeInTicks	Animation time that determines the state of the nodes
+		 *	@param	aPose			The pose which receives the local transforms. It must have been created by create_pose of this animation (or of one with the same layout).
+		 *	@param	aState			The evaluation state whose key cursors are used
+		 *	@tparam	L				The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void sample_local_pose(double aTimeInTicks, animation_pose& aPose, packed_animation_state& aState) const;
+
+		/**	Computes the global transforms of all nodes from the given pose, which is the second stage of evaluate.
+		 *	The results can be written out with write_bone_matrices afterwards.
+		 *	@param	aPose			The local transforms of all nodes
+		 *	@param	aState			The evaluation state which receives the global transforms
+		 *	@tparam	L				The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void compose(const animation_pose& aPose, packed_animation_state& aState) const;
+
+		/**	Writes the bone matrices which result from the global transforms of the given state into one single contiguous
+		 *	piece of memory, in the same way as animate_into_single_target_buffer does.
+		 *	@param	aState				The evaluation state whose global transforms have been computed by evaluate or compose
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const;
+
+		/**	Same as the glm::mat4 overload, but writes the bone matrices in the compact 3x4 format, see to_bone_matrix_3x4.
+		 *	@param	aState				The evaluation state whose global transforms have been computed by evaluate or compose
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory) const;
+
+		/**	Same as the glm::mat4 overload, but writes the bone transforms as dual quaternions, see to_bone_dual_quaternion.
+		 *	Attention: Dual quaternions can only represent rotations and translations. Use them for rigid skeletons only.
+		 *	Bone transforms which contain scaling, mirroring, or shearing are deformed incorrectly, and a warning is logged.
+		 *	@param	aState				The evaluation state whose global transforms have been computed by evaluate or compose
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by the bone transforms
+		 *	@param	aTargetMemory		Pointer to the memory location where the first dual quaternion shall be written to
+		 */
+		void write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory) const;
+
+		/**	Returns true if the poses and states of this animation and of the given one are interchangeable, which is the case
+		 *	if both animations have been created for the same meshes from clips which animate the same nodes,
+		 *	and if their nodes have been classified for the same clip (or not at all).
+		 *	Note that animation::reduce_keys removes the keys of nodes which are constant throughout a clip and folds their
+		 *	constant transforms into the parent transforms, which can make clips incompatible that have been compatible before.
+		 *	@param	aOther			The other animation
+		 */
+		bool has_same_layout(const packed_animation& aOther) const;
+
+		/**	Creates a per-node mask for blending, which contains the given weight for the given node and all of its descendants,
+		 *	and 0 for all other nodes. E.g. pass a character's spine node to restrict a blend to its upper body.
+		 *	@param	aPackedNodeIndex	Position of the subtree's root node in parent-before-child order, see animated_node_index
+		 *	@param	aWeight				The weight of the subtree's nodes
+		 */
+		std::vector<float> create_subtree_mask(size_t aPackedNodeIndex, float aWeight = 1.0f) const;
+
+		/**	Computes the global transforms of all nodes at the given animation time (in ticks).
+		 *	The results can be retrieved via global_transforms afterwards.
+		 *	@param	aTimeInTicks	Animation time that determines the state of the nodes
+		 *	@tparam	L				The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void evaluate(double aTimeInTicks)
+		{
+			evaluate<L>(aTimeInTicks, mState);
+		}
+
+		/**	Computes the global transforms of all nodes at the given animation time (in ticks) and stores them in the given state.
+		 *	This is the same as sample_local_pose into aState.mLocalPose, followed by compose.
+		 *	This method does not modify the packed_animation, i.e. it can be invoked concurrently with different states.
+		 *	@param	aTimeInTicks	Animation time that determines the state of the nodes
+		 *	@param	aState			The evaluation state, which must have been created by create_state of this animation
+		 *	@tparam	L				The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void evaluate(double aTimeInTicks, packed_animation_state& aState) const;
+
+		/**	Calculates the bone animation and writes all the bone matrices into one single contiguous piece of memory
+		 *	which receives ALL bone matrices of all meshes, s.t. a vertex transformed with one of the resulting bone matrices
+		 *	is transformed into the given target space. The result is the same as with animation::animate_into_single_target_buffer.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@tparam	L					The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+		{
+			animate_into_single_target_buffer<L>(aClip, aTime, aTargetSpace, aTargetMemory, mState);
+		}
+
+		/**	Calculates the bone animation and writes all the bone matrices into one single contiguous piece of memory,
+		 *	s.t. a vertex transformed with one of the resulting bone matrices is given in mesh space.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@tparam	L					The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, glm::mat4* aTargetMemory)
+		{
+			animate_into_single_target_buffer<L>(aClip, aTime, bone_matrices_space::mesh_space, aTargetMemory, mState);
+		}
+
+		/**	Same as the other overloads of animate_into_single_target_buffer, but uses the given evaluation state.
+		 *	This method does not modify the packed_animation, i.e. it can be invoked concurrently with different states.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@param	aState				The evaluation state, which must have been created by create_state of this animation
+		 *	@tparam	L					The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, packed_animation_state& aState) const;
+
+		/**	Animates multiple instances of this animation, each at its own time, and writes the bone matrices of each instance
+		 *	into its own region of the target memory. The instances are distributed across the threads of the given pool.
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTimes				Time in seconds to calculate the bone matrices at, one per instance
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix of the first instance shall be written to
+		 *	@param	aInstanceStride		Offset in matrices between the first bone matrices of two consecutive instances.
+		 *								Must be at least the number of matrices which one instance occupies, which is used if no value is given.
+		 *	@param	aStates				Evaluation states, one per instance. They are (re)created if their number does not match the
+		 *								number of instances. Keep them between calls so that key lookups can continue where they
+		 *								left off for every instance.
+		 *	@param	aThreadPool			The pool whose threads evaluate the instances (along with the calling thread)
+		 *	@tparam	L					The number of nodes which are evaluated at once. Must be 4 or 8.
+		 */
+		template <size_t L = sDefaultLanes>
+		void animate_instances_into_single_target_buffer(const animation_clip_data& aClip, std::span<const double> aTimes, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, std::optional<size_t> aInstanceStride, std::vector<packed_animation_state>& aStates, thread_pool& aThreadPool = thread_pool::shared()) const;
+
+		/** Returns the number of nodes */
+		size_t number_of_nodes() const { return mParentIndices.size(); }
+
+		/** Returns the number of bone matrices which are written by animate_into_single_target_buffer */
+		size_t number_of_bone_matrices() const { return mBoneTargetIndices.size(); }
+
+		/** Returns the number of matrices which the target memory of animate_into_single_target_buffer must have room for,
+		 *	i.e. the highest index of a bone matrix plus one. It exceeds number_of_bone_matrices if there are gaps between the
+		 *	bone index ranges of the meshes. */
+		size_t bone_matrix_buffer_size() const;
+
+		/**	Returns the index of the animated node from which the node at the given packed position has been created,
+		 *	i.e. the index which can be passed to animation::get_animated_node_at.
+		 *	@param	aPackedNodeIndex	Position of the node in parent-before-child order
+		 */
+		size_t animated_node_index(size_t aPackedNodeIndex) const { return mAnimatedNodeIndices[aPackedNodeIndex]; }
+
+		/** Returns the global transforms of all nodes in parent-before-child order, as computed by the most recent evaluation
+		 *	which has not been given an explicit evaluation state */
+		std::span<const glm::mat4> global_transforms() const { return mState.mGlobalTransforms; }
+
+		/** Returns the format in which the key values are stored */
+		animation_key_format key_format() const { return mKeyFormat; }
+
+		/** Returns the number of bytes which are occupied by the key times, the key values, and their ranges */
+		size_t key_data_size_in_bytes() const;
+
+		/** ASSIMP's animation clip index that was used to create the animation */
+		uint32_t animation_index() const { return mAnimationIndex; }
+
+		/** The start and end ticks of the clip which the nodes of the original animation had been classified for when this
+		 *	packed_animation was created (see animation::classify_nodes), or no value if they had not been classified.
+		 *	Constant nodes have been folded into the parent transforms, i.e. the animation is only valid within this range. */
+		const std::optional<std::tuple<double, double>>& classified_tick_range() const { return mClassifiedTickRange; }
+
+		/** Checks whether the given clip can be used with this animation, and throws if not. */
+		void validate_clip(const animation_clip_data& aClip) const;
+
+	private:
+		/** Value of mParentIndices for nodes without animated parent */
+		static constexpr uint32_t sNoParent = std::numeric_limits<uint32_t>::max();
+
+		/** The range of one node's keys within one of the pooled key arrays */
+		struct key_range
+		{
+			uint32_t mOffset = 0;
+			uint32_t mCount = 0;
+		};
+
+		/** Per node: Index of the animated parent node (which is always smaller than the node's own index), or sNoParent */
+		std::vector<uint32_t> mParentIndices;
+		/** Per node: Index of the animated_node in the original animation */
+		std::vector<uint32_t> mAnimatedNodeIndices;
+		/** Per node: Transform between the animated parent and the node. For nodes without keys, it contains their local transform, too. */
+		std::vector<glm::mat4> mParentTransforms;
+
+		/** Per node: Ranges of the node's keys in the pooled key arrays */
+		std::vector<key_range> mTranslationRanges;
+		std::vector<key_range> mRotationRanges;
+		std::vector<key_range> mScalingRanges;
+
+		/** Maps the 16-bit components of a node's quantized key values to their value range */
+		struct quantization_range
+		{
+			glm::vec3 mMin = glm::vec3{ 0.0f };
+			glm::vec3 mStep = glm::vec3{ 0.0f };
+		};
+
+		/** Pooled key times of all nodes */
+		std::vector<float> mTranslationTimes;
+		std::vector<float> mRotationTimes;
+		std::vector<float> mScalingTimes;
+
+		/** Pooled key values of all nodes if mKeyFormat is full_precision */
+		std::vector<glm::vec3> mTranslationValues;
+		std::vector<glm::quat> mRotationValues;
+		std::vector<glm::vec3> mScalingValues;
+
+		/** Pooled key values of all nodes if mKeyFormat is quantized, and per node: the ranges of the translations and scalings */
+		std::vector<std::array<uint16_t, 3>> mQuantizedTranslationValues;
+		std::vector<std::array<uint16_t, 3>> mQuantizedRotationValues;
+		std::vector<std::array<uint16_t, 3>> mQuantizedScalingValues;
+		std::vector<quantization_range> mTranslationQuantizationRanges;
+		std::vector<quantization_range> mScalingQuantizationRanges;
+
+		animation_key_format mKeyFormat = animation_key_format::full_precision;
+
+		/** Per bone matrix: The node which it is computed from, where it is written to, and the matrices which are applied */
+		std::vector<uint32_t> mBoneNodeIndices;
+		std::vector<size_t> mBoneTargetIndices;
+		std::vector<glm::mat4> mBoneInverseMeshRootMatrices;
+		std::vector<glm::mat4> mBoneInverseBindPoseMatrices;
+
+		/** Number of instances which animate_instances_into_single_target_buffer evaluates per task */
+		static constexpr size_t sInstancesPerTask = 8;
+
+		/** Return the value of the given key in the pooled key arrays of the given node, for both key formats */
+		glm::vec3 translation_key_value(uint32_t aNode, uint32_t aKey) const;
+		glm::quat rotation_key_value(uint32_t aNode, uint32_t aKey) const;
+		glm::vec3 scaling_key_value(uint32_t aNode, uint32_t aKey) const;
+
+		/** Writes the bone matrices of the given state after converting them with aConvert: T(const glm::mat4&) */
+		template <typename T, typename C>
+		void write_converted_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, T* aTargetMemory, C aConvert) const;
+
+		/** Evaluation state used by the methods which are not given an explicit one */
+		packed_animation_state mState;
+
+		uint32_t mAnimationIndex = 0;
+
+		/** See classified_tick_range */
+		std::optional<std::tuple<double, double>> mClassifiedTickRange;
+
+		friend packed_animation_gpu_data convert_for_gpu_usage(const packed_animation& aAnimation, bone_matrices_space aTargetSpace);
+	};
+
+	/**	Blends two poses, i.e. interpolates the local transforms of all nodes. Rotations are blended with normalized lerp.
+	 *	@param	aFrom		The pose which is returned for a weight of 0
+	 *	@param	aTo			The pose which is returned for a weight of 1
+	 *	@param	aWeight		The blend weight
+	 *	@param	aResult		The blended pose. May be the same as aFrom or aTo.
+	 *	@param	aMask		Optional per-node factors for aWeight, e.g. created by packed_animation::create_subtree_mask
+	 */
+	void blend_poses(const animation_pose& aFrom, const animation_pose& aTo, float aWeight, animation_pose& aResult, std::span<const float> aMask = {});
+
+	/**	Creates an additive pose, i.e. the difference between a pose and a reference pose (e.g. the first frame of an additive clip),
+	 *	which can be applied on top of other poses with apply_additive_pose.
+	 *	@param	aPose			The pose
+	 *	@param	aReferencePose	The reference pose, which is subtracted from aPose
+	 */
+	animation_pose make_additive_pose(const animation_pose& aPose, const animation_pose& aReferencePose);
+
+	/**	Applies an additive pose on top of a base pose: translations are added, rotations and scales are multiplied.
+	 *	@param	aBase		The base pose
+	 *	@param	aAdditive	The additive pose, as created by make_additive_pose
+	 *	@param	aWeight		The weight with which the additive pose is applied
+	 *	@param	aResult		The resulting pose. May be the same as aBase.
+	 *	@param	aMask		Optional per-node factors for aWeight, e.g. created by packed_animation::create_subtree_mask
+	 */
+	void apply_additive_pose(const animation_pose& aBase, const animation_pose& aAdditive, float aWeight, animation_pose& aResult, std::span<const float> aMask = {});
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** Four 16-bit unsigned normalized values. Stored in buffers as vk::Format::eR16G16B16A16Unorm,
+	 *	i.e. a shader reads them as floats in the range [0, 1].
+	 */
+	struct unorm16x4
+	{
+		glm::u16vec4 mValue;
+	};
+
+	/** Two 16-bit signed normalized values. Stored in buffers as vk::Format::eR16G16Snorm,
+	 *	i.e. a shader reads them as floats in the range [-1, 1].
+	 */
+	struct snorm16x2
+	{
+		glm::i16vec2 mValue;
+	};
+
+	/** Two 16-bit half precision floating point values. Stored in buffers as vk::Format::eR16G16Sfloat. */
+	struct float16x2
+	{
+		glm::u16vec2 mValue;
+	};
+
+	/** Four 8-bit unsigned normalized values. Stored in buffers as vk::Format::eR8G8B8A8Unorm,
+	 *	i.e. a shader reads them as floats in the range [0, 1].
+	 */
+	struct unorm8x4
+	{
+		glm::u8vec4 mValue;
+	};
+
+	/** Constants to reconstruct positions from 16-bit quantized positions.
+	 *	A quantized position q (as read by a shader, i.e. in the range [0, 1]) is reconstructed via:
+	 *		position = mOffset.xyz + mScale.xyz * q.xyz
+	 *	The layout matches a std140/std430 struct of two vec4s, so that an array of these can be
+	 *	uploaded to a uniform or storage buffer directly.
+	 */
+	struct position_dequantization
+	{
+		/** The minimum corner of the bounding box, w is unused */
+		glm::vec4 mOffset;
+		/** The extent of the bounding box, w is unused */
+		glm::vec4 mScale;
+	};
+
+	template <> inline vk::Format format_for<unorm16x4>() { return vk::Format::eR16G16B16A16Unorm; }
+	template <> inline vk::Format format_for<snorm16x2>() { return vk::Format::eR16G16Snorm; }
+	template <> inline vk::Format format_for<float16x2>() { return vk::Format::eR16G16Sfloat; }
+	template <> inline vk::Format format_for<unorm8x4>() { return vk::Format::eR8G8B8A8Unorm; }
+
+	/** Computes the dequantization constants for positions within the given bounds. */
+	inline position_dequantization make_position_dequantization(const glm::vec3& aMin, const glm::vec3& aMax)
+	{
+		return position_dequantization{ glm::vec4{ aMin, 0.0f }, glm::vec4{ aMax - aMin, 0.0f } };
+	}
+
+	/** Quantizes a position to 16 bits per component relative to the bounds described by aDequantization.
+	 *	@param	aPosition			The position to quantize. Must lie within the bounds.
+	 *	@param	aDequantization		Bounds which the position is quantized relative to
+	 *	@param	aW					Raw value to be stored in the otherwise unused fourth component
+	 */
+	inline unorm16x4 quantize_position(const glm::vec3& aPosition, const position_dequantization& aDequantization, uint16_t aW = 0)
+	{
+		const auto scale = glm::vec3{ aDequantization.mScale };
+		const auto safeScale = glm::vec3{
+			scale.x > 0.0f ? scale.x : 1.0f,
+			scale.y > 0.0f ? scale.y : 1.0f,
+			scale.z > 0.0f ? scale.z : 1.0f
+		};
+		const auto normalized = glm::clamp((aPosition - glm::vec3{ aDequantization.mOffset }) / safeScale, glm::vec3{ 0.0f }, glm::vec3{ 1.0f });
+		const auto q = glm::u16vec3(glm::round(normalized * 65535.0f));
+		return unorm16x4{ glm::u16vec4{ q, aW } };
+	}
+
+	/** Reconstructs a position from its quantized representation. (CPU-side reference for what a shader has to do.) */
+	inline glm::vec3 dequantize_position(const unorm16x4& aQuantized, const position_dequantization& aDequantization)
+	{
+		return glm::vec3{ aDequantization.mOffset } + glm::vec3{ aDequantization.mScale } * (glm::vec3{ aQuantized.mValue } / 65535.0f);
+	}
+
+	/** Encodes a unit vector with octahedral encoding into two 16-bit signed normalized values.
+	 *	Decoding in a shader (where e is the value read as vec2 in [-1, 1]):
+	 *		vec3 n = vec3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+	 *		float t = max(-n.z, 0.0);
+	 *		n.x += n.x >= 0.0 ? -t : t;
+	 *		n.y += n.y >= 0.0 ? -t : t;
+	 *		n = normalize(n);
+	 */
+	inline snorm16x2 encode_octahedral(const glm::vec3& aDirection)
+	{
+		const auto l1 = glm::abs(aDirection.x) + glm::abs(aDirection.y) + glm::abs(aDirection.z);
+		if (l1 <= 0.0f) {
+			return snorm16x2{ glm::i16vec2{ 0, 0 } }; // => decodes to (0,0,1)
+		}
+		auto p = glm::vec2{ aDirection.x, aDirection.y } / l1;
+		if (aDirection.z < 0.0f) {
+			const auto signNotZero = glm::vec2{ p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f };
+			p = (1.0f - glm::abs(glm::vec2{ p.y, p.x })) * signNotZero;
+		}
+		return snorm16x2{ glm::i16vec2(glm::round(glm::clamp(p, -1.0f, 1.0f) * 32767.0f)) };
+	}
+
+	/** Decodes an octahedral-encoded unit vector. (CPU-side reference for what a shader has to do.) */
+	inline glm::vec3 decode_octahedral(const snorm16x2& aEncoded)
+	{
+		const auto e = glm::max(glm::vec2{ aEncoded.mValue } / 32767.0f, glm::vec2{ -1.0f });
+		auto n = glm::vec3{ e.x, e.y, 1.0f - glm::abs(e.x) - glm::abs(e.y) };
+		const auto t = glm::max(-n.z, 0.0f);
+		n.x += n.x >= 0.0f ? -t : t;
+		n.y += n.y >= 0.0f ? -t : t;
+		return glm::normalize(n);
+	}
+
+	/** Converts two floats into half precision floats. */
+	inline float16x2 to_float16x2(const glm::vec2& aValue)
+	{
+		const auto packed = glm::packHalf2x16(aValue);
+		return float16x2{ glm::u16vec2{ static_cast<uint16_t>(packed & 0xFFFFu), static_cast<uint16_t>(packed >> 16) } };
+	}
+
+	/** Quantizes bone weights to 8 bits each. If the weights sum up to one, the quantized weights
+	 *	are adjusted to sum up to exactly 255, s.t. they still sum up to one after dequantization.
+	 */
+	inline unorm8x4 quantize_bone_weights(const glm::vec4& aWeights)
+	{
+		auto q = glm::u8vec4(glm::round(glm::clamp(aWeights, glm::vec4{ 0.0f }, glm::vec4{ 1.0f }) * 255.0f));
+		const auto sum = aWeights.x + aWeights.y + aWeights.z + aWeights.w;
+		if (glm::abs(sum - 1.0f) < 1e-3f) {
+			const int quantizedSum = q.x + q.y + q.z + q.w;
+			int largest = 0;
+			for (int i = 1; i < 4; ++i) {
+				if (q[i] > q[largest]) {
+					largest = i;
+				}
+			}
+			q[largest] = static_cast<uint8_t>(static_cast<int>(q[largest]) + 255 - quantizedSum);
+		}
+		return unorm8x4{ q };
+	}
+
+	/** Converts bone indices into a smaller integer type.
+	 *	@tparam	T	Either glm::u8vec4 or glm::u16vec4
+	 *	Throws if an index is not representable with the smaller type.
+	 */
+	template <typename T>
+	T narrow_bone_indices(const glm::uvec4& aIndices)
+	{
+		constexpr auto maxIndex = static_cast<uint32_t>(std::numeric_limits<typename T::value_type>::max());
+		if (aIndices.x > maxIndex || aIndices.y > maxIndex || aIndices.z > maxIndex || aIndices.w > maxIndex) {
+			throw avk::runtime_error(fmt::format("Bone indices ({},{},{},{}) can not be represented with {} bits.", aIndices.x, aIndices.y, aIndices.z, aIndices.w, 8 * sizeof(typename T::value_type)));
+		}
+		return T(aIndices);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, unorm16x4& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y, aValue.mValue.z, aValue.mValue.w);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, snorm16x2& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, float16x2& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, unorm8x4& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y, aValue.mValue.z, aValue.mValue.w);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, position_dequantization& aValue)
+	{
+		aArchive(aValue.mOffset, aValue.mScale);
+	}
+}
@@ -47,7 +47,7 @@
  *  invalidate old cache files. An exception will be thrown if the cache file's version and the framework's serializer
  *  versions do not match.
  */
-#define SERIALIZER_CACHE_FILE_VERSION 0x00000001
+#define SERIALIZER_CACHE_FILE_VERSION 0x00000003
 
 namespace avk {
 
@@ -383,6 +383,18 @@ namespace glm {
 		aArchive(aValue.x, aValue.y, aValue.z, aValue.w);
 	}
 
+	template<typename Archive>
+	void serialize(Archive& aArchive, glm::u8vec4& aValue)
+	{
+		aArchive(aValue.x, aValue.y, aValue.z, aValue.w);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, glm::u16vec4& aValue)
+	{
+		aArchive(aValue.x, aValue.y, aValue.z, aValue.w);
+	}
+
 	template<typename Archive>
 	void serialize(Archive& aArchive, glm::ivec2& aValue)
 	{
@@ -572,7 +584,11 @@ namespace avk {
 			aValue.mScalingKeys,
 			aValue.mSameRotationAndPositionKeyTimes,
 			aValue.mSameScalingAndPositionKeyTimes,
+			aValue.mUniformKeyInterval,
 			aValue.mLocalTransform,
+			aValue.mAnimationClass,
+			aValue.mStaticLocalTransform,
+			aValue.mConstantGlobalTransform,
 			aValue.mGlobalTransform,
 			aValue.mAnimatedParentIndex,
 			aValue.mParentTransform,
@@ -586,7 +602,8 @@ namespace avk {
 		aArchive(
 			aValue.mAnimationData,
 			aValue.mAnimationIndex,
-			aValue.mMaxNumBoneMatrices
+			aValue.mMaxNumBoneMatrices,
+			aValue.mClassifiedTickRange
 		);
 	}
 }
@@ -0,0 +1,120 @@
+#pragma once
+
+namespace avk
+{
+	/** A simple pool of worker threads which execute submitted tasks in FIFO order.
+	 *	It is used by Auto-Vk-Toolkit's loading and data preparation helpers (see `thread_pool::shared()`),
+	 *	but separate instances can be created for other purposes as well.
+	 */
+	class thread_pool
+	{
+	public:
+		/** Creates a pool with the given number of worker threads (at least one). */
+		explicit thread_pool(size_t aNumThreads = std::thread::hardware_concurrency());
+		thread_pool(thread_pool&&) noexcept = delete;
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(thread_pool&&) noexcept = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+		/** Finishes all tasks that have already been submitted and joins the worker threads. */
+		~thread_pool();
+
+		/** The number of worker threads of this pool */
+		size_t num_threads() const { return mWorkers.size(); }
+
+		/** Enqueues a task for execution on one of the worker threads.
+		 *	@param	aTask	Invocable without parameters
+		 *	@return	A future to the task's result. Exceptions thrown by the task are propagated through it.
+		 */
+		template <typename F>
+		auto submit(F&& aTask) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+		{
+			using result_t = std::invoke_result_t<std::decay_t<F>>;
+			auto task = std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(aTask));
+			auto future = task->get_future();
+			enqueue([task]() { (*task)(); });
+			return future;
+		}
+
+		/** Invokes `aFunc(i)` for every i in [0, aCount) and blocks until all invocations have completed.
+		 *	The invocations are distributed across the worker threads AND the calling thread, which means
+		 *	that it is safe to call this from within a task that runs on the same pool.
+		 *	If any invocation throws, the remaining indices are still processed, and the first exception
+		 *	is rethrown on the calling thread afterwards.
+		 *	@param	aCount	Number of invocations
+		 *	@param	aFunc	Invocable with signature void(size_t); must be safe to be called concurrently.
+		 */
+		template <typename F>
+		void parallel_for(size_t aCount, F&& aFunc)
+		{
+			if (0 == aCount) {
+				return;
+			}
+			if (1 == aCount || mWorkers.empty()) {
+				for (size_t i = 0; i < aCount; ++i) {
+					aFunc(i);
+				}
+				return;
+			}
+
+			// The state is shared with the helper tasks, which might only start executing
+			// after all indices have been processed (and this function has returned):
+			struct shared_state
+			{
+				std::atomic<size_t> mNext{ 0 };
+				size_t mDone = 0;
+				std::exception_ptr mFirstException;
+				std::mutex mMutex;
+				std::condition_variable mAllDone;
+			};
+			auto state = std::make_shared<shared_state>();
+
+			// Note: aFunc is only accessed for indices < aCount, i.e. while the calling thread is still waiting.
+			auto work = [state, aCount, &aFunc]() {
+				size_t i;
+				while ((i = state->mNext.fetch_add(1)) < aCount) {
+					std::exception_ptr ex;
+					try {
+						aFunc(i);
+					}
+					catch (...) {
+						ex = std::current_exception();
+					}
+					std::scoped_lock lock(state->mMutex);
+					if (ex && !state->mFirstException) {
+						state->mFirstException = ex;
+					}
+					if (++state->mDone == aCount) {
+						state->mAllDone.notify_all();
+					}
+				}
+			};
+
+			const auto numHelpers = std::min(aCount - 1, mWorkers.size());
+			for (size_t h = 0; h < numHelpers; ++h) {
+				enqueue(work);
+			}
+			work();
+
+			std::unique_lock lock(state->mMutex);
+			state->mAllDone.wait(lock, [&state, aCount]() { return state->mDone == aCount; });
+			if (state->mFirstException) {
+				std::rethrow_exception(state->mFirstException);
+			}
+		}
+
+		/** Gets the pool which is shared by all of Auto-Vk-Toolkit's helper functions.
+		 *	It is created upon first use with one worker thread per hardware thread.
+		 */
+		static thread_pool& shared();
+
+	private:
+		void enqueue(std::function<void()> aTask);
+		void worker_loop();
+
+		std::vector<std::thread> mWorkers;
+		std::queue<std::function<void()>> mTasks;
+		std::mutex mMutex;
+		std::condition_variable mTaskAvailable;
+		bool mStopping = false;
+	};
+}
@@ -5,13 +5,128 @@
 
 namespace avk
 {
-	glm::vec3 animation::compute_node_local_translation(const animated_node& aNode, double aTimeInTicks) const
+	namespace
+	{
+		/**	Reduces the given keys to those which cannot be reconstructed within aMaxError by interpolating between the
+		 *	remaining keys. The first and the last key are always kept, unless all keys are within aMaxError of the first one.
+		 *	@param	aKeys			The keys, sorted by time
+		 *	@param	aInterpolate	Invocable which interpolates between two key values like during animation: V(const V&, const V&, float)
+		 *	@param	aError			Invocable which returns the error between two key values: float(const V&, const V&)
+		 *	@param	aMaxError		The maximum permitted error
+		 */
+		template <typename K, typename I, typename E>
+		std::vector<K> reduce_key_collection(const std::vector<K>& aKeys, I aInterpolate, E aError, float aMaxError)
+		{
+			if (aKeys.size() < 2) {
+				return aKeys;
+			}
+			if (std::all_of(aKeys.begin() + 1, aKeys.end(), [&](const K& aKey) { return aError(aKeys.front().mValue, aKey.mValue) <= aMaxError; })) {
+				return { aKeys.front() };
+			}
+
+			// Greedily extend the segment which starts at the most recently kept key as long as all the keys in between can be reconstructed:
+			std::vector<K> result{ aKeys.front() };
+			size_t anchor = 0;
+			for (size_t end = 2; end < aKeys.size(); ++end) {
+				const auto& k1 = aKeys[anchor];
+				const auto& k2 = aKeys[end];
+				bool reconstructible = true;
+				for (size_t i = anchor + 1; i < end && reconstructible; ++i) {
+					const auto f = static_cast<float>((aKeys[i].mTime - k1.mTime) / (k2.mTime - k1.mTime));
+					reconstructible = aError(aInterpolate(k1.mValue, k2.mValue, f), aKeys[i].mValue) <= aMaxError;
+				}
+				if (!reconstructible) {
+					anchor = end - 1;
+					result.push_back(aKeys[anchor]);
+				}
+			}
+			result.push_back(aKeys.back());
+			return result;
+		}
+
+		/** Returns the angle (in radians) of the rotation between two unit quaternions */
+		float rotation_angle_between(const glm::quat& aValue1, const glm::quat& aValue2)
+		{
+			// Computed from the chord length instead of acos(dot), which is more accurate for small angles:
+			const auto chord = std::min(glm::length(aValue1 - aValue2), glm::length(aValue1 + aValue2));
+			return 4.0f * std::asin(std::min(chord * 0.5f, 1.0f));
+		}
+
+		/**	Returns true if all keys which are interpolated between within the given time range are within aMaxError of
+		 *	each other, i.e. if the key collection yields a constant value during that range.
+		 *	@param	aKeys			The keys, sorted by time
+		 *	@param	aStartTicks		Start of the time range
+		 *	@param	aEndTicks		End of the time range
+		 *	@param	aError			Invocable which returns the error between two key values: float(const V&, const V&)
+		 *	@param	aMaxError		The maximum permitted error
+		 */
+		template <typename K, typename E>
+		bool is_constant_in_range(const std::vector<K>& aKeys, double aStartTicks, double aEndTicks, E aError, float aMaxError)
+		{
+			if (aKeys.size() < 2) {
+				return true;
+			}
+			// From the last key at or before the start (or the first key), to the first key at or after the end (or the last key):
+			const auto maxIndex = aKeys.size() - 1;
+			const auto afterStart = std::upper_bound(aKeys.begin(), aKeys.end(), aStartTicks, [](double aTime, const K& aKey) { return aTime < aKey.mTime; });
+			const auto first = afterStart == aKeys.begin() ? size_t{ 0 } : static_cast<size_t>(std::distance(aKeys.begin(), afterStart)) - 1;
+			const auto atOrAfterEnd = std::lower_bound(aKeys.begin(), aKeys.end(), aEndTicks, [](const K& aKey, double aTime) { return aKey.mTime < aTime; });
+			const auto last = std::max(std::min(static_cast<size_t>(std::distance(aKeys.begin(), atOrAfterEnd)), maxIndex), std::min(first + 1, maxIndex));
+			for (size_t i = first + 1; i <= last; ++i) {
+				if (aError(aKeys[first].mValue, aKeys[i].mValue) > aMaxError) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**	Calculates the bone animation and passes each final bone matrix to aWrite, in the same way as the
+		 *	glm::mat4 overloads of animation::animate_into_strided_target_per_mesh and animation::animate_into_single_target_buffer do.
+		 *	@param	aWrite		Invocable which stores a bone matrix in the target format: void(mesh_bone_info, const glm::mat4&)
+		 */
+		template <typename W>
+		void animate_bone_matrices(animation& aAnimation, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, W aWrite)
+		{
+			switch (aTargetSpace) {
+			case bone_matrices_space::mesh_space:
+				aAnimation.animate(aClip, aTime, [&aWrite](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+					aWrite(aInfo, aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix);
+				});
+				break;
+			case bone_matrices_space::model_space:
+				aAnimation.animate(aClip, aTime, [&aWrite](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+					aWrite(aInfo, aTransformMatrix * aInverseBindPoseMatrix);
+				});
+				break;
+			default:
+				throw avk::runtime_error("Unknown target space value.");
+			}
+		}
+
+		/**	Writes the bone matrices of an animation into strided memory, after converting them with aConvert.
+		 *	The parameters are the same as those of animation::animate_into_strided_target_per_mesh.
+		 */
+		template <typename T, typename C>
+		void animate_into_strided_target_per_mesh_as(animation& aAnimation, const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, T* aTargetMemory, size_t aMeshStride, std::optional<size_t> aStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh, C aConvert)
+		{
+			animate_bone_matrices(aAnimation, aClip, aTime, aTargetSpace,
+				[target = reinterpret_cast<uint8_t*>(aTargetMemory), meshStride = aMeshStride, stride = aStride.value_or(sizeof(T)), maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max()), &aConvert]
+				(mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+					if (aInfo.mMeshAnimationIndex < maxMeshes && aInfo.mMeshLocalBoneIndex < maxBones) {
+						*reinterpret_cast<T*>(target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * stride) = aConvert(aBoneMatrix);
+					}
+				}
+			);
+		}
+	}
+
+	glm::vec3 animation::compute_node_local_translation(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors) const
 	{
 		glm::vec3 localTranslation;
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mPositionKeys.size() > 0) { 
-			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks);
+			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mPositionKey : nullptr);
 			auto tf = get_interpolation_factor(aNode.mPositionKeys[tpos1], aNode.mPositionKeys[tpos2], aTimeInTicks);
 			localTranslation = glm::lerp(aNode.mPositionKeys[tpos1].mValue, aNode.mPositionKeys[tpos2].mValue, tf);
 		}
@@ -24,13 +139,13 @@ namespace avk
 		return localTranslation;
 	}
 
-	glm::quat animation::compute_node_local_rotation(const animated_node& aNode, double aTimeInTicks) const
+	glm::quat animation::compute_node_local_rotation(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors) const
 	{
 		glm::quat localRotation;
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mRotationKeys.size() > 0) {
-			auto [rpos1, rpos2] = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks);
+			auto [rpos1, rpos2] = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mRotationKey : nullptr);
 			auto rf = get_interpolation_factor(aNode.mRotationKeys[rpos1], aNode.mRotationKeys[rpos2], aTimeInTicks);
 			localRotation = glm::slerp(aNode.mRotationKeys[rpos1].mValue, aNode.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
 			localRotation = glm::normalize(localRotation); // normalize the resulting quaternion, just to be on the safe side
@@ -44,13 +159,13 @@ namespace avk
 		return localRotation;
 	}
 
-	glm::vec3 animation::compute_node_local_scale(const animated_node& aNode, double aTimeInTicks) const
+	glm::vec3 animation::compute_node_local_scale(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors) const
 	{
 		glm::vec3 localScale;
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mScalingKeys.size() > 0) {
-			auto [spos1, spos2] = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks);
+			auto [spos1, spos2] = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mScalingKey : nullptr);
 			auto sf = get_interpolation_factor(aNode.mScalingKeys[spos1], aNode.mScalingKeys[spos2], aTimeInTicks);
 			localScale = glm::lerp(aNode.mScalingKeys[spos1].mValue, aNode.mScalingKeys[spos2].mValue, sf);
 		}
@@ -63,21 +178,37 @@ namespace avk
 		return localScale;
 	}
 	
-	glm::mat4 animation::compute_node_local_transform(const animated_node& aNode, double aTimeInTicks) const
+	glm::mat4 animation::compute_node_local_transform(const animated_node& aNode, double aTimeInTicks, animated_node_key_cursors* aKeyCursors) const
 	{
+		// Classified nodes (see classify_nodes) only need to evaluate the key collections which change:
+		switch (aNode.mAnimationClass) {
+		case node_animation_class::constant:
+			return aNode.mStaticLocalTransform;
+		case node_animation_class::translation_only:
+		{
+			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mPositionKey : nullptr);
+			auto tf = get_interpolation_factor(aNode.mPositionKeys[tpos1], aNode.mPositionKeys[tpos2], aTimeInTicks);
+			auto localTransform = aNode.mStaticLocalTransform;
+			localTransform[3] = glm::vec4{ glm::lerp(aNode.mPositionKeys[tpos1].mValue, aNode.mPositionKeys[tpos2].mValue, tf), 1.0f };
+			return localTransform;
+		}
+		default:
+			break;
+		}
+
 		glm::mat4 localTransform;
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mPositionKeys.size() + aNode.mRotationKeys.size() + aNode.mScalingKeys.size() > 0) {
 			// Translation/position:
-			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks);
+			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mPositionKey : nullptr);
 			auto tf = get_interpolation_factor(aNode.mPositionKeys[tpos1], aNode.mPositionKeys[tpos2], aTimeInTicks);
 			auto translation = glm::lerp(aNode.mPositionKeys[tpos1].mValue, aNode.mPositionKeys[tpos2].mValue, tf);
 
 			// Rotation:
 			size_t rpos1 = tpos1, rpos2 = tpos2;
 			if (!aNode.mSameRotationAndPositionKeyTimes) {
-				std::tie(rpos1, rpos2) = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks);
+				std::tie(rpos1, rpos2) = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mRotationKey : nullptr);
 			}
 			auto rf = get_interpolation_factor(aNode.mRotationKeys[rpos1], aNode.mRotationKeys[rpos2], aTimeInTicks);
 			auto rotation = glm::slerp(aNode.mRotationKeys[rpos1].mValue, aNode.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
@@ -86,7 +217,7 @@ namespace avk
 			// Scaling:
 			size_t spos1 = tpos1, spos2 = tpos2;
 			if (!aNode.mSameScalingAndPositionKeyTimes) {
-				std::tie(spos1, spos2) = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks);
+				std::tie(spos1, spos2) = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr != aKeyCursors ? &aKeyCursors->mScalingKey : nullptr);
 			}
 			auto sf = get_interpolation_factor(aNode.mScalingKeys[spos1], aNode.mScalingKeys[spos2], aTimeInTicks);
 			auto scaling = glm::lerp(aNode.mScalingKeys[spos1].mValue, aNode.mScalingKeys[spos2].mValue, sf);
@@ -106,7 +237,7 @@ namespace avk
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mPositionKeys.size() > 0) {
-			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks);
+			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			auto tf = get_interpolation_factor(aNode.mPositionKeys[tpos1], aNode.mPositionKeys[tpos2], aTimeInTicks);
 			inverseLocalTranslation = glm::lerp(-aNode.mPositionKeys[tpos1].mValue, -aNode.mPositionKeys[tpos2].mValue, tf);
 		}
@@ -125,7 +256,7 @@ namespace avk
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mRotationKeys.size() > 0) {
-			auto [rpos1, rpos2] = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks);
+			auto [rpos1, rpos2] = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			auto rf = get_interpolation_factor(aNode.mRotationKeys[rpos1], aNode.mRotationKeys[rpos2], aTimeInTicks);
 			localRotation = glm::slerp(glm::inverse(aNode.mRotationKeys[rpos1].mValue), glm::inverse(aNode.mRotationKeys[rpos2].mValue), rf);	// use slerp, not lerp or mix (those lead to jerks)
 			localRotation = glm::normalize(localRotation); // normalize the resulting quaternion, just to be on the safe side
@@ -145,7 +276,7 @@ namespace avk
 
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mScalingKeys.size() > 0) {
-			auto [spos1, spos2] = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks);
+			auto [spos1, spos2] = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			auto sf = get_interpolation_factor(aNode.mScalingKeys[spos1], aNode.mScalingKeys[spos2], aTimeInTicks);
 			localScale = glm::lerp(1.0f / aNode.mScalingKeys[spos1].mValue, 1.0f / aNode.mScalingKeys[spos2].mValue, sf);
 		}
@@ -165,14 +296,14 @@ namespace avk
 		// The localTransform can only be different than the identity if there are animation keys.
 		if (aNode.mPositionKeys.size() + aNode.mRotationKeys.size() + aNode.mScalingKeys.size() > 0) {
 			// Translation/position:
-			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks);
+			auto [tpos1, tpos2] = find_positions_in_keys(aNode.mPositionKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			auto tf = get_interpolation_factor(aNode.mPositionKeys[tpos1], aNode.mPositionKeys[tpos2], aTimeInTicks);
 			auto translation = glm::lerp(-aNode.mPositionKeys[tpos1].mValue, -aNode.mPositionKeys[tpos2].mValue, tf);
 
 			// Rotation:
 			size_t rpos1 = tpos1, rpos2 = tpos2;
 			if (!aNode.mSameRotationAndPositionKeyTimes) {
-				std::tie(rpos1, rpos2) = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks);
+				std::tie(rpos1, rpos2) = find_positions_in_keys(aNode.mRotationKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			}
 			auto rf = get_interpolation_factor(aNode.mRotationKeys[rpos1], aNode.mRotationKeys[rpos2], aTimeInTicks);
 			auto rotation = glm::slerp(glm::inverse(aNode.mRotationKeys[rpos1].mValue), glm::inverse(aNode.mRotationKeys[rpos2].mValue), rf);	// use slerp, not lerp or mix (those lead to jerks)
@@ -181,7 +312,7 @@ namespace avk
 			// Scaling:
 			size_t spos1 = tpos1, spos2 = tpos2;
 			if (!aNode.mSameScalingAndPositionKeyTimes) {
-				std::tie(spos1, spos2) = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks);
+				std::tie(spos1, spos2) = find_positions_in_keys(aNode.mScalingKeys, aTimeInTicks, aNode.mUniformKeyInterval, nullptr);
 			}
 			auto sf = get_interpolation_factor(aNode.mScalingKeys[spos1], aNode.mScalingKeys[spos2], aTimeInTicks);
 			auto scaling = glm::lerp(1.0f / aNode.mScalingKeys[spos1].mValue, 1.0f / aNode.mScalingKeys[spos2].mValue, sf);
@@ -268,6 +399,181 @@ namespace avk
 		}
 	}
 
+	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		animate_into_strided_target_per_mesh_as(*this, aClip, aTime, aTargetSpace, aTargetMemory, aMeshStride, aMatricesStride, aMaxMeshes, aMaxBonesPerMesh, to_bone_matrix_3x4);
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		animate_into_strided_target_per_mesh_as(*this, aClip, aTime, aTargetSpace, aTargetMemory, aMeshStride, aMatricesStride, aMaxMeshes, aMaxBonesPerMesh, to_bone_dual_quaternion);
+	}
+
+	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory)
+	{
+		animate_bone_matrices(*this, aClip, aTime, aTargetSpace, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+			aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = to_bone_matrix_3x4(aBoneMatrix);
+		});
+	}
+
+	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory)
+	{
+		animate_bone_matrices(*this, aClip, aTime, aTargetSpace, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aBoneMatrix){
+			aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = to_bone_dual_quaternion(aBoneMatrix);
+		});
+	}
+
+	void animation::resample_keys_uniformly(double aKeyIntervalInTicks)
+	{
+		if (!(aKeyIntervalInTicks > 0.0)) {
+			throw avk::runtime_error("The key interval for resampling must be greater than 0.");
+		}
+
+		for (auto& anode : mAnimationData) {
+			// Determine the time range which is spanned by all the key collections with more than one key:
+			double startTicks = std::numeric_limits<double>::max();
+			double endTicks = std::numeric_limits<double>::lowest();
+			const auto extendRange = [&](const auto& aKeys) {
+				if (aKeys.size() > 1) {
+					startTicks = std::min(startTicks, aKeys.front().mTime);
+					endTicks = std::max(endTicks, aKeys.back().mTime);
+				}
+			};
+			extendRange(anode.mPositionKeys);
+			extendRange(anode.mRotationKeys);
+			extendRange(anode.mScalingKeys);
+			if (startTicks > endTicks) {
+				continue; // Nothing to resample
+			}
+
+			// The last key is placed at or after endTicks, s.t. the whole range is covered:
+			const auto numKeys = static_cast<size_t>(std::ceil((endTicks - startTicks) / aKeyIntervalInTicks - 1e-9)) + 1;
+			const auto keyTime = [&](size_t aIndex) { return startTicks + static_cast<double>(aIndex) * aKeyIntervalInTicks; };
+
+			// Evaluate the original keys at the new key times (before mUniformKeyInterval is set):
+			anode.mUniformKeyInterval.reset();
+			if (anode.mPositionKeys.size() > 1) {
+				std::vector<position_key> keys(numKeys);
+				for (size_t i = 0; i < numKeys; ++i) {
+					keys[i] = position_key{ keyTime(i), compute_node_local_translation(anode, std::min(keyTime(i), endTicks)) };
+				}
+				anode.mPositionKeys = std::move(keys);
+			}
+			if (anode.mRotationKeys.size() > 1) {
+				std::vector<rotation_key> keys(numKeys);
+				for (size_t i = 0; i < numKeys; ++i) {
+					keys[i] = rotation_key{ keyTime(i), compute_node_local_rotation(anode, std::min(keyTime(i), endTicks)) };
+				}
+				anode.mRotationKeys = std::move(keys);
+			}
+			if (anode.mScalingKeys.size() > 1) {
+				std::vector<scaling_key> keys(numKeys);
+				for (size_t i = 0; i < numKeys; ++i) {
+					keys[i] = scaling_key{ keyTime(i), compute_node_local_scale(anode, std::min(keyTime(i), endTicks)) };
+				}
+				anode.mScalingKeys = std::move(keys);
+			}
+
+			// All resampled collections share their key times now:
+			const auto sameKeyTimes = [](const auto& aKeys1, const auto& aKeys2) {
+				return !aKeys1.empty() && aKeys1.size() == aKeys2.size() && aKeys1.front().mTime == aKeys2.front().mTime;
+			};
+			anode.mSameRotationAndPositionKeyTimes = sameKeyTimes(anode.mPositionKeys, anode.mRotationKeys);
+			anode.mSameScalingAndPositionKeyTimes = sameKeyTimes(anode.mPositionKeys, anode.mScalingKeys);
+			anode.mUniformKeyInterval = aKeyIntervalInTicks;
+		}
+	}
+
+	void animation::reduce_keys(float aMaxTranslationError, float aMaxRotationError, float aMaxScalingError)
+	{
+		const auto lerp = [](const glm::vec3& aValue1, const glm::vec3& aValue2, float aFactor) { return glm::lerp(aValue1, aValue2, aFactor); };
+		const auto slerp = [](const glm::quat& aValue1, const glm::quat& aValue2, float aFactor) { return glm::normalize(glm::slerp(aValue1, aValue2, aFactor)); };
+		const auto distance = [](const glm::vec3& aValue1, const glm::vec3& aValue2) { return glm::distance(aValue1, aValue2); };
+		const auto sameKeyTimes = [](const auto& aKeys1, const auto& aKeys2) {
+			return !aKeys1.empty() && std::equal(aKeys1.begin(), aKeys1.end(), aKeys2.begin(), aKeys2.end(), [](const auto& aKey1, const auto& aKey2) { return aKey1.mTime == aKey2.mTime; });
+		};
+
+		for (auto& anode : mAnimationData) {
+			anode.mPositionKeys = reduce_key_collection(anode.mPositionKeys, lerp, distance, aMaxTranslationError);
+			anode.mRotationKeys = reduce_key_collection(anode.mRotationKeys, slerp, rotation_angle_between, aMaxRotationError);
+			anode.mScalingKeys = reduce_key_collection(anode.mScalingKeys, lerp, distance, aMaxScalingError);
+
+			// A node whose key collections are all constant does not need any keys at all:
+			if (anode.mPositionKeys.size() == 1 && anode.mRotationKeys.size() == 1 && anode.mScalingKeys.size() == 1) {
+				anode.mLocalTransform = matrix_from_transforms(anode.mPositionKeys.front().mValue, anode.mRotationKeys.front().mValue, anode.mScalingKeys.front().mValue);
+				anode.mPositionKeys.clear();
+				anode.mRotationKeys.clear();
+				anode.mScalingKeys.clear();
+			}
+
+			anode.mSameRotationAndPositionKeyTimes = sameKeyTimes(anode.mPositionKeys, anode.mRotationKeys);
+			anode.mSameScalingAndPositionKeyTimes = sameKeyTimes(anode.mPositionKeys, anode.mScalingKeys);
+			anode.mUniformKeyInterval.reset();
+		}
+	}
+
+	void animation::classify_nodes(const animation_clip_data& aClip, float aMaxTranslationError, float aMaxRotationError, float aMaxScalingError)
+	{
+		if (aClip.mAnimationIndex != mAnimationIndex) {
+			throw avk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+		}
+		const auto distance = [](const glm::vec3& aValue1, const glm::vec3& aValue2) { return glm::distance(aValue1, aValue2); };
+
+		// Constant subtrees are detected in a single pass, which requires parents to come before their children.
+		// Check it for all nodes upfront, s.t. no node is left classified if it does not hold:
+		const auto n = mAnimationData.size();
+		for (size_t i = 0; i < n; ++i) {
+			if (mAnimationData[i].mAnimatedParentIndex.has_value() && mAnimationData[i].mAnimatedParentIndex.value() >= i) {
+				throw avk::runtime_error("Animated nodes must be given in parent-before-child order.");
+			}
+		}
+
+		for (size_t i = 0; i < n; ++i) {
+			auto& anode = mAnimationData[i];
+			anode.mAnimationClass = node_animation_class::full;
+			anode.mConstantGlobalTransform = false;
+
+			const bool translationConstant = is_constant_in_range(anode.mPositionKeys, aClip.mStartTicks, aClip.mEndTicks, distance, aMaxTranslationError);
+			const bool rotationConstant = is_constant_in_range(anode.mRotationKeys, aClip.mStartTicks, aClip.mEndTicks, rotation_angle_between, aMaxRotationError);
+			const bool scalingConstant = is_constant_in_range(anode.mScalingKeys, aClip.mStartTicks, aClip.mEndTicks, distance, aMaxScalingError);
+			if (!rotationConstant || !scalingConstant) {
+				continue;
+			}
+
+			// The constant parts are taken from the local transform at the clip's start:
+			anode.mStaticLocalTransform = compute_node_local_transform(anode, aClip.mStartTicks);
+			if (!translationConstant) {
+				anode.mStaticLocalTransform[3] = glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f };
+				anode.mAnimationClass = node_animation_class::translation_only;
+				continue;
+			}
+			anode.mAnimationClass = node_animation_class::constant;
+
+			// Precompute the global transforms of constant subtrees:
+			if (anode.mAnimatedParentIndex.has_value()) {
+				const auto& parent = mAnimationData[anode.mAnimatedParentIndex.value()];
+				if (parent.mConstantGlobalTransform) {
+					anode.mGlobalTransform = parent.mGlobalTransform * anode.mParentTransform * anode.mStaticLocalTransform;
+					anode.mConstantGlobalTransform = true;
+				}
+			}
+			else {
+				anode.mGlobalTransform = anode.mParentTransform * anode.mStaticLocalTransform;
+				anode.mConstantGlobalTransform = true;
+			}
+		}
+		mClassifiedTickRange = std::make_tuple(aClip.mStartTicks, aClip.mEndTicks);
+	}
+
+	void animation::reset_node_classification()
+	{
+		for (auto& anode : mAnimationData) {
+			anode.mAnimationClass = node_animation_class::full;
+			anode.mConstantGlobalTransform = false;
+		}
+		mClassifiedTickRange.reset();
+	}
+
 	std::vector<double> animation::animation_key_times_for_clip_in_ticks(const animation_clip_data& aClip) const
 	{
 		const double cMachineEpsilon = 2.3e-16;
@@ -432,4 +738,48 @@ namespace avk
 		}
 		return result;
 	}
+
+	glm::mat3x4 to_bone_matrix_3x4(const glm::mat4& aBoneMatrix)
+	{
+		return glm::transpose(glm::mat4x3{ aBoneMatrix });
+	}
+
+	/** Maximum deviation of the lengths of a bone matrix' axes from 1 (and of their dot products from 0) which to_bone_dual_quaternion tolerates without warning */
+	static constexpr float sMaxBoneScaleDeviation = 1e-3f;
+
+	glm::dualquat to_bone_dual_quaternion(const glm::mat4& aBoneMatrix)
+	{
+		// Remove scaling (and mirroring) s.t. only the rotation remains:
+		glm::mat3 rotation{ aBoneMatrix };
+		bool lossy = false;
+		for (int i = 0; i < 3; ++i) {
+			const auto length = glm::length(rotation[i]);
+			lossy = lossy || std::abs(length - 1.0f) > sMaxBoneScaleDeviation;
+			if (length > std::numeric_limits<float>::min()) {
+				rotation[i] /= length;
+			}
+		}
+		if (glm::determinant(rotation) < 0.0f) {
+			rotation[0] = -rotation[0];
+			lossy = true;
+		}
+		// Shearing leaves the normalized axes non-orthogonal:
+		lossy = lossy
+			|| std::abs(glm::dot(rotation[0], rotation[1])) > sMaxBoneScaleDeviation
+			|| std::abs(glm::dot(rotation[0], rotation[2])) > sMaxBoneScaleDeviation
+			|| std::abs(glm::dot(rotation[1], rotation[2])) > sMaxBoneScaleDeviation;
+		if (lossy) {
+			// Bone matrices are converted every frame => report it only once:
+			static std::atomic_bool sReported = false;
+			if (!sReported.exchange(true)) {
+				LOG_WARNING("A bone matrix which contains scaling, mirroring, or shearing has been converted into a dual quaternion, which can only represent rotations and translations. Skinned meshes will be deformed incorrectly. Use bone matrices for such skeletons.");
+			}
+		}
+		return glm::dualquat{ glm::normalize(glm::quat_cast(rotation)), glm::vec3{ aBoneMatrix[3] } };
+	}
+
+	glm::mat4 to_bone_matrix(const glm::dualquat& aBoneDualQuaternion)
+	{
+		return glm::mat4{ glm::transpose(glm::mat3x4_cast(aBoneDualQuaternion)) };
+	}
 }
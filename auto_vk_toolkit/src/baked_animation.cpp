@@ -0,0 +1,213 @@
+#include "baked_animation.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		/** Number of instances which baked_animation::sample_instances samples per task */
+		constexpr size_t sBakedInstancesPerTask = 16;
+
+		glm::quat load_quat(const float* aData)
+		{
+			return glm::quat{ aData[3], aData[0], aData[1], aData[2] };
+		}
+
+		void store_quat(const glm::quat& aQuat, float* aData)
+		{
+			aData[0] = aQuat.x;
+			aData[1] = aQuat.y;
+			aData[2] = aQuat.z;
+			aData[3] = aQuat.w;
+		}
+
+		/** Splits a bone matrix into translation, rotation, and scaling. A negative determinant is attributed to the x scaling. */
+		void decompose_bone_matrix(const glm::mat4& aMatrix, glm::vec3& aTranslation, glm::quat& aRotation, glm::vec3& aScaling)
+		{
+			const glm::mat3 m{ aMatrix };
+			aScaling = glm::vec3{ glm::length(m[0]), glm::length(m[1]), glm::length(m[2]) };
+			if (glm::determinant(m) < 0.0f) {
+				aScaling.x = -aScaling.x;
+			}
+			glm::mat3 rotation;
+			for (int i = 0; i < 3; ++i) {
+				rotation[i] = std::abs(aScaling[i]) > std::numeric_limits<float>::min() ? m[i] / aScaling[i] : glm::vec3{ 0.0f };
+			}
+			aRotation = glm::normalize(glm::quat_cast(rotation));
+			aTranslation = glm::vec3{ aMatrix[3] };
+		}
+
+		/**	Writes a bone matrix in the given format. aPrevious points to the same bone in the previous frame (or is nullptr),
+		 *	and the signs of quaternions are chosen s.t. they are in the same hemisphere as their predecessors, i.e. consecutive
+		 *	frames can be interpolated without checking for the shorter path. */
+		void store_bone(const glm::mat4& aMatrix, baked_bone_format aFormat, float* aData, const float* aPrevious)
+		{
+			switch (aFormat) {
+			case baked_bone_format::matrix:
+				std::copy_n(glm::value_ptr(aMatrix), 16, aData);
+				break;
+			case baked_bone_format::dual_quaternion:
+			{
+				auto dualQuaternion = to_bone_dual_quaternion(aMatrix);
+				if (nullptr != aPrevious && glm::dot(dualQuaternion.real, load_quat(aPrevious)) < 0.0f) {
+					dualQuaternion.real = -dualQuaternion.real;
+					dualQuaternion.dual = -dualQuaternion.dual;
+				}
+				store_quat(dualQuaternion.real, aData);
+				store_quat(dualQuaternion.dual, aData + 4);
+				break;
+			}
+			case baked_bone_format::translation_rotation_scale:
+			{
+				glm::vec3 translation, scaling;
+				glm::quat rotation;
+				decompose_bone_matrix(aMatrix, translation, rotation, scaling);
+				if (nullptr != aPrevious && glm::dot(rotation, load_quat(aPrevious)) < 0.0f) {
+					rotation = -rotation;
+				}
+				store_quat(rotation, aData);
+				std::copy_n(glm::value_ptr(translation), 3, aData + 4);
+				std::copy_n(glm::value_ptr(scaling), 3, aData + 7);
+				break;
+			}
+			default:
+				throw avk::runtime_error("Unknown baked bone format.");
+			}
+		}
+	}
+
+	size_t baked_animation::floats_per_bone() const
+	{
+		switch (mFormat) {
+		case baked_bone_format::matrix:
+			return 16;
+		case baked_bone_format::dual_quaternion:
+			return 8;
+		case baked_bone_format::translation_rotation_scale:
+			return 10;
+		default:
+			throw avk::runtime_error("Unknown baked bone format.");
+		}
+	}
+
+	void baked_animation::sample(double aTime, glm::mat4* aTargetMemory) const
+	{
+		if (0 == mNumberOfFrames) {
+			throw avk::runtime_error("The baked animation does not contain any frames.");
+		}
+		const auto position = std::clamp((aTime - mStartTime) * mFramesPerSecond, 0.0, static_cast<double>(mNumberOfFrames - 1));
+		const auto frame0 = static_cast<size_t>(position);
+		const auto frame1 = std::min(frame0 + 1, static_cast<size_t>(mNumberOfFrames - 1));
+		const auto w = static_cast<float>(position - static_cast<double>(frame0));
+		const float* a = mData.data() + frame0 * floats_per_frame();
+		const float* b = mData.data() + frame1 * floats_per_frame();
+		const auto n = static_cast<size_t>(mBonesPerFrame);
+
+		switch (mFormat) {
+		case baked_bone_format::matrix:
+			for (size_t i = 0; i < n; ++i, a += 16, b += 16) {
+				float* target = glm::value_ptr(aTargetMemory[i]);
+				for (int e = 0; e < 16; ++e) {
+					target[e] = a[e] + (b[e] - a[e]) * w;
+				}
+			}
+			break;
+		case baked_bone_format::dual_quaternion:
+			for (size_t i = 0; i < n; ++i, a += 8, b += 8) {
+				float dq[8];
+				for (int e = 0; e < 8; ++e) {
+					dq[e] = a[e] + (b[e] - a[e]) * w;
+				}
+				aTargetMemory[i] = to_bone_matrix(glm::dualquat{ load_quat(dq), load_quat(dq + 4) });
+			}
+			break;
+		case baked_bone_format::translation_rotation_scale:
+			for (size_t i = 0; i < n; ++i, a += 10, b += 10) {
+				float trs[10];
+				for (int e = 0; e < 10; ++e) {
+					trs[e] = a[e] + (b[e] - a[e]) * w;
+				}
+				auto& target = aTargetMemory[i];
+				target = glm::mat4_cast(glm::normalize(load_quat(trs)));
+				target[0] *= trs[7];
+				target[1] *= trs[8];
+				target[2] *= trs[9];
+				target[3] = glm::vec4{ trs[4], trs[5], trs[6], 1.0f };
+			}
+			break;
+		default:
+			throw avk::runtime_error("Unknown baked bone format.");
+		}
+	}
+
+	void baked_animation::sample_instances(std::span<const double> aTimes, glm::mat4* aTargetMemory, std::optional<size_t> aInstanceStride, thread_pool& aThreadPool) const
+	{
+		const auto instanceStride = aInstanceStride.value_or(mBonesPerFrame);
+		if (instanceStride < mBonesPerFrame) {
+			throw avk::runtime_error("The instance stride must not be smaller than the number of bone matrices of an instance.");
+		}
+
+		const auto numInstances = aTimes.size();
+		const auto numTasks = (numInstances + sBakedInstancesPerTask - 1) / sBakedInstancesPerTask;
+		aThreadPool.parallel_for(numTasks, [&](size_t aTask) {
+			const auto end = std::min((aTask + 1) * sBakedInstancesPerTask, numInstances);
+			for (size_t i = aTask * sBakedInstancesPerTask; i < end; ++i) {
+				sample(aTimes[i], aTargetMemory + i * instanceStride);
+			}
+		});
+	}
+
+	baked_animation bake_animation(const packed_animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_bone_format aFormat, bone_matrices_space aTargetSpace)
+	{
+		aAnimation.validate_clip(aClip);
+		if (!(aFramesPerSecond > 0.0)) {
+			throw avk::runtime_error("The number of frames per second must be greater than 0.");
+		}
+
+		baked_animation result;
+		result.mFormat = aFormat;
+		result.mStartTime = aClip.start_time();
+		result.mBonesPerFrame = static_cast<uint32_t>(aAnimation.bone_matrix_buffer_size());
+
+		// Choose the number of frames s.t. the last one is exactly at the end of the clip:
+		const auto duration = std::max(aClip.end_time() - aClip.start_time(), 0.0);
+		const auto numIntervals = std::ceil(duration * aFramesPerSecond - 1e-6);
+		result.mNumberOfFrames = static_cast<uint32_t>(std::max(numIntervals, 0.0)) + 1;
+		result.mFramesPerSecond = result.mNumberOfFrames > 1 ? static_cast<double>(result.mNumberOfFrames - 1) / duration : aFramesPerSecond;
+
+		const auto floatsPerBone = result.floats_per_bone();
+		const auto floatsPerFrame = result.floats_per_frame();
+		result.mData.resize(floatsPerFrame * result.mNumberOfFrames);
+
+		auto state = aAnimation.create_state();
+		std::vector<glm::mat4> boneMatrices(result.mBonesPerFrame, glm::mat4{ 1.0f });
+		for (uint32_t f = 0; f < result.mNumberOfFrames; ++f) {
+			const auto ticks = f + 1 == result.mNumberOfFrames && f > 0
+				? aClip.mEndTicks
+				: aClip.mStartTicks + f / result.mFramesPerSecond * aClip.mTicksPerSecond;
+			aAnimation.evaluate(ticks, state);
+			aAnimation.write_bone_matrices(state, aTargetSpace, boneMatrices.data());
+
+			float* frame = result.mData.data() + f * floatsPerFrame;
+			const float* previousFrame = f > 0 ? frame - floatsPerFrame : nullptr;
+			for (size_t i = 0; i < boneMatrices.size(); ++i) {
+				store_bone(boneMatrices[i], aFormat, frame + i * floatsPerBone, nullptr != previousFrame ? previousFrame + i * floatsPerBone : nullptr);
+			}
+		}
+		return result;
+	}
+
+	baked_animation bake_animation_cached(serializer& aSerializer, const packed_animation& aAnimation, const animation_clip_data& aClip, double aFramesPerSecond, baked_bone_format aFormat, bone_matrices_space aTargetSpace)
+	{
+		baked_animation result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = bake_animation(aAnimation, aClip, aFramesPerSecond, aFormat, aTargetSpace);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+
+	std::tuple<avk::buffer, avk::command::action_type_command> create_baked_animation_buffer(const baked_animation& aBakedAnimation, vk::BufferUsageFlags aUsageFlags)
+	{
+		return create_buffer<std::vector<float>, avk::storage_buffer_meta>(aBakedAnimation.mData, aUsageFlags);
+	}
+}
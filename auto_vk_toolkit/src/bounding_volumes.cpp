@@ -0,0 +1,192 @@
+#include "bounding_volumes.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		template <typename I>
+		normal_cone compute_normal_cone_impl(std::span<const glm::vec3> aPositions, std::span<const I> aIndices)
+		{
+			std::vector<glm::vec3> normals;
+			std::vector<size_t> firstIndices;
+			normals.reserve(aIndices.size() / 3);
+			firstIndices.reserve(aIndices.size() / 3);
+			glm::vec3 normalSum{ 0.0f };
+			bounding_box box;
+			for (size_t i = 0; i + 2 < aIndices.size(); i += 3) {
+				const auto& p0 = aPositions[aIndices[i]];
+				const auto& p1 = aPositions[aIndices[i + 1]];
+				const auto& p2 = aPositions[aIndices[i + 2]];
+				box.extend(p0);
+				box.extend(p1);
+				box.extend(p2);
+				const auto n = glm::cross(p1 - p0, p2 - p0);
+				const auto lengthSq = glm::dot(n, n);
+				if (lengthSq <= std::numeric_limits<float>::min()) {
+					continue; // Degenerate triangles can face any direction => ignore them
+				}
+				normals.push_back(n / std::sqrt(lengthSq));
+				firstIndices.push_back(i);
+				normalSum += normals.back();
+			}
+
+			normal_cone result;
+			const auto sumLengthSq = glm::dot(normalSum, normalSum);
+			if (normals.empty() || sumLengthSq <= std::numeric_limits<float>::min()) {
+				return result;
+			}
+			const auto axis = normalSum / std::sqrt(sumLengthSq);
+
+			float minDot = 1.0f;
+			for (const auto& n : normals) {
+				minDot = glm::min(minDot, glm::dot(n, axis));
+			}
+			if (minDot <= 0.1f) {
+				// The normals span (almost) a hemisphere or more => culling would (almost) never succeed
+				return result;
+			}
+
+			// Move the apex backwards along the axis from the center until it lies behind all of the triangles' planes,
+			// s.t. the test is conservative for cameras close to the triangles, too:
+			const auto center = box.center();
+			float maxT = 0.0f;
+			for (size_t t = 0; t < normals.size(); ++t) {
+				const auto& n = normals[t];
+				const auto& p0 = aPositions[aIndices[firstIndices[t]]];
+				const auto dc = glm::dot(center - p0, n);
+				const auto dn = glm::dot(axis, n);
+				maxT = glm::max(maxT, dc / dn);
+			}
+
+			result.mApex = center - axis * maxT;
+			result.mAxis = axis;
+			result.mCutoff = std::sqrt(1.0f - minDot * minDot);
+			return result;
+		}
+	}
+
+	bounding_box compute_bounding_box(std::span<const glm::vec3> aPoints)
+	{
+		bounding_box result;
+		for (const auto& p : aPoints) {
+			result.extend(p);
+		}
+		return result;
+	}
+
+	bounding_sphere compute_bounding_sphere(std::span<const glm::vec3> aPoints)
+	{
+		if (aPoints.empty()) {
+			return bounding_sphere{};
+		}
+
+		// Start with the pair of extreme points along the axis with the largest spread:
+		size_t minIndex[3] = { 0, 0, 0 };
+		size_t maxIndex[3] = { 0, 0, 0 };
+		for (size_t i = 1; i < aPoints.size(); ++i) {
+			for (int a = 0; a < 3; ++a) {
+				if (aPoints[i][a] < aPoints[minIndex[a]][a]) { minIndex[a] = i; }
+				if (aPoints[i][a] > aPoints[maxIndex[a]][a]) { maxIndex[a] = i; }
+			}
+		}
+		int axis = 0;
+		float maxSpread = -1.0f;
+		for (int a = 0; a < 3; ++a) {
+			const auto spread = glm::distance(aPoints[minIndex[a]], aPoints[maxIndex[a]]);
+			if (spread > maxSpread) {
+				maxSpread = spread;
+				axis = a;
+			}
+		}
+		bounding_sphere sphere{ 0.5f * (aPoints[minIndex[axis]] + aPoints[maxIndex[axis]]), 0.5f * maxSpread };
+
+		// Grow the sphere towards every point outside of it (Ritter). The second pass tightens
+		// the result, because the first pass may have grown the sphere in suboptimal directions.
+		for (int pass = 0; pass < 2; ++pass) {
+			for (const auto& p : aPoints) {
+				const auto d = glm::distance(p, sphere.mCenter);
+				if (d > sphere.mRadius) {
+					const auto newRadius = 0.5f * (sphere.mRadius + d);
+					sphere.mCenter += (newRadius - sphere.mRadius) / d * (p - sphere.mCenter);
+					sphere.mRadius = newRadius;
+				}
+			}
+		}
+
+		// Guard against floating point inaccuracies, s.t. all points are guaranteed to be inside:
+		float radius = 0.0f;
+		for (const auto& p : aPoints) {
+			radius = glm::max(radius, glm::distance(p, sphere.mCenter));
+		}
+		sphere.mRadius = radius;
+
+		const auto boxSphere = bounding_sphere_for(compute_bounding_box(aPoints));
+		return boxSphere.mRadius < sphere.mRadius ? boxSphere : sphere;
+	}
+
+	normal_cone compute_normal_cone(std::span<const glm::vec3> aPositions, std::span<const uint32_t> aIndices)
+	{
+		return compute_normal_cone_impl(aPositions, aIndices);
+	}
+
+	normal_cone compute_normal_cone(std::span<const glm::vec3> aPositions, std::span<const uint8_t> aIndices)
+	{
+		return compute_normal_cone_impl(aPositions, aIndices);
+	}
+
+	bounding_sphere bounding_sphere_for(const bounding_box& aBox)
+	{
+		if (aBox.empty()) {
+			return bounding_sphere{};
+		}
+		return bounding_sphere{ aBox.center(), 0.5f * glm::length(aBox.extent()) };
+	}
+
+	bounding_sphere merge(const bounding_sphere& aFirst, const bounding_sphere& aSecond)
+	{
+		if (aFirst.empty()) {
+			return aSecond;
+		}
+		if (aSecond.empty()) {
+			return aFirst;
+		}
+		const auto d = glm::distance(aFirst.mCenter, aSecond.mCenter);
+		if (d + aSecond.mRadius <= aFirst.mRadius) {
+			return aFirst;
+		}
+		if (d + aFirst.mRadius <= aSecond.mRadius) {
+			return aSecond;
+		}
+		const auto radius = 0.5f * (d + aFirst.mRadius + aSecond.mRadius);
+		return bounding_sphere{ aFirst.mCenter + (radius - aFirst.mRadius) / d * (aSecond.mCenter - aFirst.mCenter), radius };
+	}
+
+	bounding_box transformed(const bounding_box& aBox, const glm::mat4& aMatrix)
+	{
+		if (aBox.empty()) {
+			return aBox;
+		}
+		// Arvo, "Transforming Axis-Aligned Bounding Boxes":
+		const auto translation = glm::vec3{ aMatrix[3] };
+		bounding_box result{ translation, translation };
+		for (int col = 0; col < 3; ++col) {
+			for (int row = 0; row < 3; ++row) {
+				const auto a = aMatrix[col][row] * aBox.mMin[col];
+				const auto b = aMatrix[col][row] * aBox.mMax[col];
+				result.mMin[row] += glm::min(a, b);
+				result.mMax[row] += glm::max(a, b);
+			}
+		}
+		return result;
+	}
+
+	bounding_sphere transformed(const bounding_sphere& aSphere, const glm::mat4& aMatrix)
+	{
+		if (aSphere.empty()) {
+			return aSphere;
+		}
+		const glm::vec3 axes[3] = { glm::vec3{ aMatrix[0] }, glm::vec3{ aMatrix[1] }, glm::vec3{ aMatrix[2] } };
+		const auto maxScaleSq = glm::max(glm::dot(axes[0], axes[0]), glm::max(glm::dot(axes[1], axes[1]), glm::dot(axes[2], axes[2])));
+		return bounding_sphere{ glm::vec3{ aMatrix * glm::vec4{ aSphere.mCenter, 1.0f } }, aSphere.mRadius * std::sqrt(maxScaleSq) };
+	}
+}
@@ -0,0 +1,376 @@
+#include "cluster_lod_helpers.hpp"
+#include "thread_pool.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		uint64_t welded_edge_key(uint32_t aA, uint32_t aB)
+		{
+			if (aA > aB) {
+				std::swap(aA, aB);
+			}
+			return (static_cast<uint64_t>(aA) << 32) | static_cast<uint64_t>(aB);
+		}
+
+		// Maps every vertex to the first vertex with the same position, s.t. clusters which
+		// only share duplicated vertices (e.g. along texture seams) are still detected as neighbors.
+		std::vector<uint32_t> weld_positions(const std::vector<glm::vec3>& aPositions)
+		{
+			struct position_hash
+			{
+				size_t operator()(const glm::vec3& aValue) const
+				{
+					return std::hash<float>{}(aValue.x) ^ (std::hash<float>{}(aValue.y) * 0x9E3779B97F4A7C15ull) ^ (std::hash<float>{}(aValue.z) * 0xC2B2AE3D27D4EB4Full);
+				}
+			};
+			std::unordered_map<glm::vec3, uint32_t, position_hash> firstOccurrence;
+			firstOccurrence.reserve(aPositions.size());
+			std::vector<uint32_t> result(aPositions.size());
+			for (uint32_t i = 0; i < static_cast<uint32_t>(aPositions.size()); ++i) {
+				result[i] = firstOccurrence.try_emplace(aPositions[i], i).first->second;
+			}
+			return result;
+		}
+
+		// Appends the triangles of the given meshlet to aIndices, with indices into the vertices of the mesh
+		void append_triangles(const meshlet& aMeshlet, std::vector<uint32_t>& aIndices)
+		{
+			for (uint32_t i = 0; i < aMeshlet.mIndexCount; ++i) {
+				aIndices.push_back(aMeshlet.mVertices[aMeshlet.mIndices[i]]);
+			}
+		}
+
+		// Partitions the given clusters into groups of up to aGroupSize clusters each. Groups are grown greedily from
+		// seed clusters by adding the neighbor which shares the most edges with the group. Clusters are expected to be
+		// ordered spatially coherent (as produced by divide_triangles_into_meshlets), which is why seeds are picked in order.
+		std::vector<std::vector<uint32_t>> group_clusters(const std::vector<lod_cluster>& aClusters, const std::vector<uint32_t>& aClusterIndices, const std::vector<uint32_t>& aWelded, uint32_t aGroupSize)
+		{
+			const auto numClusters = static_cast<uint32_t>(aClusterIndices.size());
+
+			// Find pairs of clusters which share edges:
+			std::vector<std::tuple<uint64_t, uint32_t>> edges;
+			for (uint32_t c = 0; c < numClusters; ++c) {
+				const auto& ml = aClusters[aClusterIndices[c]].mMeshlet;
+				for (uint32_t i = 0; i + 2 < ml.mIndexCount; i += 3) {
+					const auto a = aWelded[ml.mVertices[ml.mIndices[i]]];
+					const auto b = aWelded[ml.mVertices[ml.mIndices[i + 1]]];
+					const auto d = aWelded[ml.mVertices[ml.mIndices[i + 2]]];
+					edges.emplace_back(welded_edge_key(a, b), c);
+					edges.emplace_back(welded_edge_key(b, d), c);
+					edges.emplace_back(welded_edge_key(d, a), c);
+				}
+			}
+			std::ranges::sort(edges);
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+			std::vector<std::tuple<uint32_t, uint32_t>> sharedEdges;
+			for (size_t begin = 0; begin < edges.size();) {
+				auto end = begin + 1;
+				while (end < edges.size() && std::get<0>(edges[end]) == std::get<0>(edges[begin])) {
+					++end;
+				}
+				for (auto i = begin; i < end; ++i) {
+					for (auto j = begin; j < end; ++j) {
+						if (i != j) {
+							sharedEdges.emplace_back(std::get<1>(edges[i]), std::get<1>(edges[j]));
+						}
+					}
+				}
+				begin = end;
+			}
+			std::ranges::sort(sharedEdges);
+
+			// Adjacency with the number of shared edges as weight:
+			std::vector<std::vector<std::tuple<uint32_t, uint32_t>>> neighbors(numClusters);
+			for (size_t begin = 0; begin < sharedEdges.size();) {
+				auto end = begin + 1;
+				while (end < sharedEdges.size() && sharedEdges[end] == sharedEdges[begin]) {
+					++end;
+				}
+				const auto [from, to] = sharedEdges[begin];
+				neighbors[from].emplace_back(to, static_cast<uint32_t>(end - begin));
+				begin = end;
+			}
+
+			std::vector<std::vector<uint32_t>> groups;
+			std::vector<bool> grouped(numClusters, false);
+			std::unordered_map<uint32_t, uint32_t> candidateWeights;
+			for (uint32_t seed = 0; seed < numClusters; ++seed) {
+				if (grouped[seed]) {
+					continue;
+				}
+				auto& group = groups.emplace_back();
+				candidateWeights.clear();
+				auto addToGroup = [&](uint32_t aCluster) {
+					group.push_back(aClusterIndices[aCluster]);
+					grouped[aCluster] = true;
+					candidateWeights.erase(aCluster);
+					for (const auto& [neighbor, weight] : neighbors[aCluster]) {
+						if (!grouped[neighbor]) {
+							candidateWeights[neighbor] += weight;
+						}
+					}
+				};
+				addToGroup(seed);
+				while (group.size() < aGroupSize && !candidateWeights.empty()) {
+					uint32_t best = candidateWeights.begin()->first;
+					uint32_t bestWeight = candidateWeights.begin()->second;
+					for (const auto& [candidate, weight] : candidateWeights) {
+						if (weight > bestWeight || (weight == bestWeight && candidate < best)) {
+							best = candidate;
+							bestWeight = weight;
+						}
+					}
+					addToGroup(best);
+				}
+			}
+			return groups;
+		}
+
+		// The result of simplifying and re-splitting one group
+		struct simplified_group
+		{
+			std::vector<meshlet> mMeshlets;
+			float mError = 0.0f;
+		};
+
+		std::optional<simplified_group> simplify_group(const std::vector<lod_cluster>& aClusters, const std::vector<uint32_t>& aGroup, const std::vector<glm::vec3>& aPositions, const cluster_lod_config& aConfig)
+		{
+			std::vector<uint32_t> indices;
+			for (auto c : aGroup) {
+				append_triangles(aClusters[c].mMeshlet, indices);
+			}
+
+			// Simplify a compacted copy of the group's vertices:
+			std::vector<uint32_t> globalVertices(indices);
+			std::ranges::sort(globalVertices);
+			globalVertices.erase(std::unique(globalVertices.begin(), globalVertices.end()), globalVertices.end());
+			std::vector<glm::vec3> localPositions;
+			localPositions.reserve(globalVertices.size());
+			for (auto v : globalVertices) {
+				localPositions.push_back(aPositions[v]);
+			}
+			for (auto& index : indices) {
+				index = static_cast<uint32_t>(std::ranges::lower_bound(globalVertices, index) - globalVertices.begin());
+			}
+
+			lod_generation_config lodConfig;
+			lodConfig.mTargetRatios = { 0.5f };
+			lodConfig.mMaxError = 1.0f; // The error is recorded in the hierarchy instead of being bounded
+			lodConfig.mNormalWeight = 0.0f;
+			lodConfig.mTexCoordWeight = 0.0f;
+			lodConfig.mLockBorders = true; // Keeps the border to the neighboring groups (and therefore the mesh) watertight
+			lodConfig.mMinReduction = aConfig.mMinReduction;
+			auto lods = generate_lods(localPositions, {}, {}, indices, lodConfig);
+			if (lods.size() < 2) {
+				return {};
+			}
+
+			simplified_group result;
+			result.mError = lods[1].mError;
+			result.mMeshlets = divide_triangles_into_meshlets(localPositions, lods[1].mIndices, aConfig.mMaxVertices, aConfig.mMaxIndices);
+			std::vector<glm::vec3> meshletPositions;
+			for (auto& ml : result.mMeshlets) {
+				meshletPositions.clear();
+				for (auto& v : ml.mVertices) {
+					meshletPositions.push_back(localPositions[v]);
+					v = globalVertices[v];
+				}
+				ml.mBoundingBox = compute_bounding_box(meshletPositions);
+				ml.mBoundingSphere = compute_bounding_sphere(meshletPositions);
+				ml.mNormalCone = compute_normal_cone(meshletPositions, std::span<const uint8_t>(ml.mIndices.data(), ml.mIndexCount));
+			}
+			return result;
+		}
+
+		// Projects the given error onto the screen, conservatively assuming the closest point of the given bounds
+		float projected_error(float aError, const bounding_sphere& aBounds, const glm::vec3& aCameraPosition, float aProjectionScale)
+		{
+			if (aError == std::numeric_limits<float>::max()) {
+				return aError;
+			}
+			const auto distance = glm::max(glm::distance(aBounds.mCenter, aCameraPosition) - aBounds.mRadius, std::numeric_limits<float>::epsilon());
+			return aError / distance * aProjectionScale;
+		}
+	}
+
+	cluster_lod_hierarchy build_cluster_lod_hierarchy(const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const cluster_lod_config& aConfig)
+	{
+		if (aIndices.size() % 3 != 0) {
+			throw avk::runtime_error(fmt::format("The number of indices ({}) is not a multiple of three. Only triangle lists are supported.", aIndices.size()));
+		}
+		if (aConfig.mClustersPerGroup < 2) {
+			throw avk::runtime_error(fmt::format("At least two clusters per group are required to build a cluster hierarchy, but {} have been configured.", aConfig.mClustersPerGroup));
+		}
+
+		cluster_lod_hierarchy hierarchy;
+		if (aIndices.empty()) {
+			return hierarchy;
+		}
+
+		// Level 0: the original triangles
+		std::vector<meshlet> meshlets = divide_triangles_into_meshlets(aPositions, aIndices, aConfig.mMaxVertices, aConfig.mMaxIndices);
+		std::vector<glm::vec3> meshletPositions;
+		std::vector<uint32_t> currentLevel;
+		for (auto& ml : meshlets) {
+			meshletPositions.clear();
+			for (auto v : ml.mVertices) {
+				meshletPositions.push_back(aPositions[v]);
+			}
+			ml.mBoundingBox = compute_bounding_box(meshletPositions);
+			ml.mBoundingSphere = compute_bounding_sphere(meshletPositions);
+			ml.mNormalCone = compute_normal_cone(meshletPositions, std::span<const uint8_t>(ml.mIndices.data(), ml.mIndexCount));
+			auto& cluster = hierarchy.mClusters.emplace_back();
+			cluster.mLodBounds = ml.mBoundingSphere;
+			cluster.mMeshlet = std::move(ml);
+			currentLevel.push_back(static_cast<uint32_t>(hierarchy.mClusters.size() - 1));
+		}
+		hierarchy.mNumLevels = 1;
+
+		const auto welded = weld_positions(aPositions);
+		for (uint32_t level = 1; level < aConfig.mMaxLevels && currentLevel.size() > 1; ++level) {
+			const auto groups = group_clusters(hierarchy.mClusters, currentLevel, welded, aConfig.mClustersPerGroup);
+
+			std::vector<std::optional<simplified_group>> simplified(groups.size());
+			thread_pool::shared().parallel_for(groups.size(), [&](size_t i) {
+				simplified[i] = simplify_group(hierarchy.mClusters, groups[i], aPositions, aConfig);
+			});
+
+			// Link the results in group order, which keeps the hierarchy deterministic:
+			std::vector<uint32_t> nextLevel;
+			bool anySimplified = false;
+			for (size_t i = 0; i < groups.size(); ++i) {
+				if (!simplified[i].has_value()) {
+					// These clusters can not be simplified with their current neighbors. Try again with the next level's clusters:
+					nextLevel.insert(nextLevel.end(), groups[i].begin(), groups[i].end());
+					continue;
+				}
+				anySimplified = true;
+
+				const auto groupIndex = static_cast<uint32_t>(hierarchy.mGroups.size());
+				auto& group = hierarchy.mGroups.emplace_back();
+				group.mChildren = groups[i];
+				// The error and the bounds must not be smaller than those of any child, s.t. the cut is monotonic:
+				float maxChildError = 0.0f;
+				for (auto c : groups[i]) {
+					maxChildError = std::max(maxChildError, hierarchy.mClusters[c].mError);
+					group.mBounds = merge(group.mBounds, hierarchy.mClusters[c].mLodBounds);
+				}
+				group.mError = maxChildError + simplified[i]->mError;
+
+				for (auto c : groups[i]) {
+					auto& child = hierarchy.mClusters[c];
+					child.mGroup = groupIndex;
+					child.mParentError = group.mError;
+					child.mParentLodBounds = group.mBounds;
+				}
+				for (auto& ml : simplified[i]->mMeshlets) {
+					auto& parent = hierarchy.mClusters.emplace_back();
+					parent.mMeshlet = std::move(ml);
+					parent.mLevel = level;
+					parent.mError = group.mError;
+					parent.mLodBounds = group.mBounds;
+					parent.mSourceGroup = groupIndex;
+					group.mParents.push_back(static_cast<uint32_t>(hierarchy.mClusters.size() - 1));
+					nextLevel.push_back(group.mParents.back());
+				}
+			}
+
+			if (!anySimplified) {
+				break;
+			}
+			hierarchy.mNumLevels = level + 1;
+			currentLevel = std::move(nextLevel);
+		}
+
+		return hierarchy;
+	}
+
+	cluster_lod_hierarchy build_cluster_lod_hierarchy(const model_t& aModel, mesh_index_t aMeshIndex, const cluster_lod_config& aConfig)
+	{
+		auto hierarchy = build_cluster_lod_hierarchy(aModel.positions_for_mesh(aMeshIndex), aModel.indices_for_mesh<uint32_t>(aMeshIndex), aConfig);
+		for (auto& cluster : hierarchy.mClusters) {
+			cluster.mMeshlet.mMeshIndex = aMeshIndex;
+		}
+		return hierarchy;
+	}
+
+	cluster_lod_hierarchy build_cluster_lod_hierarchy_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const cluster_lod_config& aConfig)
+	{
+		cluster_lod_hierarchy hierarchy;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			hierarchy = build_cluster_lod_hierarchy(aPositions, aIndices, aConfig);
+		}
+		aSerializer.archive(hierarchy);
+		return hierarchy;
+	}
+
+	cluster_lod_hierarchy build_cluster_lod_hierarchy_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const cluster_lod_config& aConfig)
+	{
+		cluster_lod_hierarchy hierarchy;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			hierarchy = build_cluster_lod_hierarchy(aModel, aMeshIndex, aConfig);
+		}
+		aSerializer.archive(hierarchy);
+		return hierarchy;
+	}
+
+	std::vector<uint32_t> select_lod_clusters(const cluster_lod_hierarchy& aHierarchy, const glm::vec3& aCameraPosition, float aVerticalFov, float aViewportHeight, float aMaxPixelError)
+	{
+		const auto projectionScale = aViewportHeight / (2.0f * std::tan(0.5f * aVerticalFov));
+		std::vector<uint32_t> result;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(aHierarchy.mClusters.size()); ++i) {
+			const auto& cluster = aHierarchy.mClusters[i];
+			if (projected_error(cluster.mError, cluster.mLodBounds, aCameraPosition, projectionScale) <= aMaxPixelError
+				&& projected_error(cluster.mParentError, cluster.mParentLodBounds, aCameraPosition, projectionScale) > aMaxPixelError) {
+				result.push_back(i);
+			}
+		}
+		return result;
+	}
+
+	std::vector<meshlet> get_meshlets(const cluster_lod_hierarchy& aHierarchy)
+	{
+		std::vector<meshlet> result;
+		result.reserve(aHierarchy.mClusters.size());
+		for (const auto& cluster : aHierarchy.mClusters) {
+			auto& ml = result.emplace_back();
+			ml.mMeshIndex = cluster.mMeshlet.mMeshIndex;
+			ml.mVertices = cluster.mMeshlet.mVertices;
+			ml.mIndices = cluster.mMeshlet.mIndices;
+			ml.mVertexCount = cluster.mMeshlet.mVertexCount;
+			ml.mIndexCount = cluster.mMeshlet.mIndexCount;
+			ml.mBoundingBox = cluster.mMeshlet.mBoundingBox;
+			ml.mBoundingSphere = cluster.mMeshlet.mBoundingSphere;
+			ml.mNormalCone = cluster.mMeshlet.mNormalCone;
+		}
+		return result;
+	}
+
+	std::vector<lod_cluster_gpu_data> convert_cluster_lod_for_gpu_usage(const cluster_lod_hierarchy& aHierarchy)
+	{
+		std::vector<lod_cluster_gpu_data> result;
+		result.reserve(aHierarchy.mClusters.size());
+		for (const auto& cluster : aHierarchy.mClusters) {
+			result.push_back(lod_cluster_gpu_data{
+				glm::vec4{ cluster.mLodBounds.mCenter, cluster.mLodBounds.mRadius },
+				glm::vec4{ cluster.mParentLodBounds.mCenter, cluster.mParentLodBounds.mRadius },
+				cluster.mError,
+				cluster.mParentError,
+				cluster.mLevel,
+				0u
+			});
+		}
+		return result;
+	}
+
+	std::vector<lod_cluster_gpu_data> convert_cluster_lod_for_gpu_usage_cached(serializer& aSerializer, const cluster_lod_hierarchy& aHierarchy)
+	{
+		std::vector<lod_cluster_gpu_data> result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = convert_cluster_lod_for_gpu_usage(aHierarchy);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+}
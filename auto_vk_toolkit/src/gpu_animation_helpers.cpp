@@ -0,0 +1,159 @@
+#include "gpu_animation_helpers.hpp"
+
+namespace avk
+{
+	packed_animation_gpu_data convert_for_gpu_usage(const packed_animation& aAnimation, bone_matrices_space aTargetSpace)
+	{
+		if (bone_matrices_space::mesh_space != aTargetSpace && bone_matrices_space::model_space != aTargetSpace) {
+			throw avk::runtime_error("Unknown target space value.");
+		}
+
+		packed_animation_gpu_data result;
+		const auto n = static_cast<uint32_t>(aAnimation.number_of_nodes());
+		result.mNodes.reserve(n);
+
+		// Nodes are sorted by depth, i.e. each level is one contiguous range:
+		std::vector<uint32_t> levels(n, 0);
+		for (uint32_t i = 0; i < n; ++i) {
+			const auto parent = aAnimation.mParentIndices[i];
+			levels[i] = packed_animation::sNoParent == parent ? 0 : levels[parent] + 1;
+			if (i > 0 && levels[i] < levels[i - 1]) {
+				throw avk::logic_error("The nodes of the packed_animation are not sorted by depth.");
+			}
+			while (result.mLevelOffsets.size() <= levels[i]) {
+				result.mLevelOffsets.push_back(i);
+			}
+		}
+		result.mLevelOffsets.push_back(n);
+
+		for (uint32_t i = 0; i < n; ++i) {
+			auto& node = result.mNodes.emplace_back();
+			node.mParentTransform = aAnimation.mParentTransforms[i];
+			node.mParentIndex = aAnimation.mParentIndices[i];
+			node.mPadding = 0;
+
+			const auto& translations = aAnimation.mTranslationRanges[i];
+			node.mTranslationKeysOffset = static_cast<uint32_t>(result.mKeyTimes.size());
+			node.mTranslationKeyCount = translations.mCount;
+			for (uint32_t k = translations.mOffset; k < translations.mOffset + translations.mCount; ++k) {
+				result.mKeyTimes.push_back(aAnimation.mTranslationTimes[k]);
+				result.mKeyValues.emplace_back(aAnimation.translation_key_value(i, k), 0.0f);
+			}
+
+			const auto& rotations = aAnimation.mRotationRanges[i];
+			node.mRotationKeysOffset = static_cast<uint32_t>(result.mKeyTimes.size());
+			node.mRotationKeyCount = rotations.mCount;
+			for (uint32_t k = rotations.mOffset; k < rotations.mOffset + rotations.mCount; ++k) {
+				const auto rotation = aAnimation.rotation_key_value(i, k);
+				result.mKeyTimes.push_back(aAnimation.mRotationTimes[k]);
+				result.mKeyValues.emplace_back(rotation.x, rotation.y, rotation.z, rotation.w);
+			}
+
+			const auto& scalings = aAnimation.mScalingRanges[i];
+			node.mScalingKeysOffset = static_cast<uint32_t>(result.mKeyTimes.size());
+			node.mScalingKeyCount = scalings.mCount;
+			for (uint32_t k = scalings.mOffset; k < scalings.mOffset + scalings.mCount; ++k) {
+				result.mKeyTimes.push_back(aAnimation.mScalingTimes[k]);
+				result.mKeyValues.emplace_back(aAnimation.scaling_key_value(i, k), 0.0f);
+			}
+		}
+
+		const auto numBones = aAnimation.number_of_bone_matrices();
+		result.mBones.reserve(numBones);
+		for (size_t b = 0; b < numBones; ++b) {
+			auto& bone = result.mBones.emplace_back();
+			bone.mInverseMeshRootMatrix = bone_matrices_space::mesh_space == aTargetSpace ? aAnimation.mBoneInverseMeshRootMatrices[b] : glm::mat4{ 1.0f };
+			bone.mInverseBindPoseMatrix = aAnimation.mBoneInverseBindPoseMatrices[b];
+			bone.mNodeIndex = aAnimation.mBoneNodeIndices[b];
+			bone.mTargetIndex = static_cast<uint32_t>(aAnimation.mBoneTargetIndices[b]);
+			bone.mPadding[0] = bone.mPadding[1] = 0;
+		}
+		result.mNumBoneMatrices = static_cast<uint32_t>(aAnimation.bone_matrix_buffer_size());
+		result.mClassifiedTickRange = aAnimation.classified_tick_range();
+		return result;
+	}
+
+	packed_animation_gpu_data convert_for_gpu_usage_cached(serializer& aSerializer, const packed_animation& aAnimation, bone_matrices_space aTargetSpace)
+	{
+		packed_animation_gpu_data result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = convert_for_gpu_usage(aAnimation, aTargetSpace);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+
+	std::tuple<packed_animation_gpu_buffers, std::vector<avk::recorded_commands_t>> create_gpu_buffers(const packed_animation_gpu_data& aGpuData, uint32_t aMaxInstances)
+	{
+		if (aGpuData.mNodes.empty()) {
+			throw avk::runtime_error("The animation does not contain any nodes.");
+		}
+		if (0 == aMaxInstances) {
+			throw avk::runtime_error("The maximum number of instances must be greater than 0.");
+		}
+
+		packed_animation_gpu_buffers result;
+		std::vector<avk::recorded_commands_t> commands;
+		// Empty buffers are not permitted => channels without keys or animations without bones get a dummy element:
+		const auto nonEmpty = [](const auto& aData) {
+			auto copy = aData;
+			if (copy.empty()) {
+				copy.emplace_back();
+			}
+			return copy;
+		};
+
+		auto [nodes, nodesCommand] = create_buffer<std::vector<packed_animation_node_gpu_data>, avk::storage_buffer_meta>(aGpuData.mNodes);
+		auto [levelOffsets, levelOffsetsCommand] = create_buffer<std::vector<uint32_t>, avk::storage_buffer_meta>(aGpuData.mLevelOffsets);
+		auto [keyTimes, keyTimesCommand] = create_buffer<std::vector<float>, avk::storage_buffer_meta>(nonEmpty(aGpuData.mKeyTimes));
+		auto [keyValues, keyValuesCommand] = create_buffer<std::vector<glm::vec4>, avk::storage_buffer_meta>(nonEmpty(aGpuData.mKeyValues));
+		auto [bones, bonesCommand] = create_buffer<std::vector<packed_animation_bone_gpu_data>, avk::storage_buffer_meta>(nonEmpty(aGpuData.mBones));
+		result.mNodes = std::move(nodes);
+		result.mLevelOffsets = std::move(levelOffsets);
+		result.mKeyTimes = std::move(keyTimes);
+		result.mKeyValues = std::move(keyValues);
+		result.mBones = std::move(bones);
+		commands.emplace_back(std::move(nodesCommand));
+		commands.emplace_back(std::move(levelOffsetsCommand));
+		commands.emplace_back(std::move(keyTimesCommand));
+		commands.emplace_back(std::move(keyValuesCommand));
+		commands.emplace_back(std::move(bonesCommand));
+		result.mGlobalTransforms = context().create_buffer(
+			avk::memory_usage::device, {},
+			avk::storage_buffer_meta::create_from_size(sizeof(glm::mat4) * aGpuData.mNodes.size() * aMaxInstances)
+		);
+
+		result.mNumNodes = static_cast<uint32_t>(aGpuData.mNodes.size());
+		result.mNumLevels = static_cast<uint32_t>(aGpuData.mLevelOffsets.size() - 1);
+		result.mNumBones = static_cast<uint32_t>(aGpuData.mBones.size());
+		result.mNumBoneMatrices = aGpuData.mNumBoneMatrices;
+		result.mMaxInstances = aMaxInstances;
+		result.mClassifiedTickRange = aGpuData.mClassifiedTickRange;
+		return std::make_tuple(std::move(result), std::move(commands));
+	}
+
+	packed_animation_push_constants packed_animation_gpu_buffers::push_constants(const animation_clip_data& aClip, uint32_t aNumInstances, std::optional<uint32_t> aInstanceStride) const
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (mClassifiedTickRange.has_value() && mClassifiedTickRange.value() != std::make_tuple(aClip.mStartTicks, aClip.mEndTicks)) {
+			throw avk::runtime_error("The nodes of this animation have been classified for a different clip. Create the packed_animation from an animation which has been classified for the passed clip, or whose classification has been reset.");
+		}
+		if (aNumInstances > mMaxInstances) {
+			throw avk::runtime_error("The number of instances exceeds the maximum number of instances which the buffers have been created for.");
+		}
+		const auto instanceStride = aInstanceStride.value_or(mNumBoneMatrices);
+		if (instanceStride < mNumBoneMatrices) {
+			throw avk::runtime_error("The instance stride must not be smaller than the number of bone matrices of an instance.");
+		}
+		return packed_animation_push_constants{
+			static_cast<float>(aClip.mTicksPerSecond),
+			mNumNodes,
+			mNumLevels,
+			mNumBones,
+			instanceStride,
+			aNumInstances
+		};
+	}
+}
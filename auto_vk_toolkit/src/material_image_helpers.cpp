@@ -2,9 +2,179 @@
 #include "image_data.hpp"
 #include "material_image_helpers.hpp"
 #include "serializer.hpp"
+#include "thread_pool.hpp"
 
 namespace avk
 {
+	namespace
+	{
+		/** One selected mesh and the location of its data within the concatenated result arrays */
+		struct mesh_slice
+		{
+			const avk::model_t* mModel;
+			avk::mesh_index_t mMeshIndex;
+			size_t mFirstVertex;
+			size_t mFirstIndex;
+		};
+
+		/** Flattens the selection into a list of meshes and computes each mesh's first vertex and
+		 *	first index in the concatenated arrays via prefix sums over their vertex and index counts.
+		 *	@return	The list of mesh slices, the total number of vertices, and the total number of indices
+		 *			(the latter is only computed if aCountIndices is true; otherwise it is zero).
+		 */
+		std::tuple<std::vector<mesh_slice>, size_t, size_t> compute_mesh_slices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aCountIndices)
+		{
+			std::vector<mesh_slice> slices;
+			size_t numVertices = 0;
+			size_t numIndices = 0;
+			for (auto& pair : aModelsAndSelectedMeshes) {
+				const auto& modelRef = std::get<const avk::model_t&>(pair);
+				for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+					slices.push_back(mesh_slice{ &modelRef, meshIndex, numVertices, numIndices });
+					numVertices += modelRef.number_of_vertices_for_mesh(meshIndex);
+					if (aCountIndices) {
+						numIndices += static_cast<size_t>(modelRef.number_of_indices_for_mesh(meshIndex));
+					}
+				}
+			}
+			return std::make_tuple(std::move(slices), numVertices, numIndices);
+		}
+
+		/** Gets one vertex attribute of all the selected meshes. The meshes are processed in parallel
+		 *	on the shared thread pool, each one writing directly into its slice of the result.
+		 *	@param	aTransformFunc	Optional function which is applied to the texture coordinates of those
+		 *							meshes which actually contain the given set (i.e. not to default values).
+		 */
+		template <typename T>
+		std::vector<T> get_vertex_attribute(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, avk::vertex_attribute aAttribute, int aSet = 0, T(*aTransformFunc)(const T&) = nullptr)
+		{
+			assert(sizeof(T) == avk::size_of(aAttribute));
+			auto [slices, numVertices, numIndices] = compute_mesh_slices(aModelsAndSelectedMeshes, false);
+			std::vector<T> result(numVertices);
+			const std::span<std::byte> destination(reinterpret_cast<std::byte*>(result.data()), result.size() * sizeof(T));
+			const std::vector<avk::vertex_attribute_layout> layout{ avk::vertex_attribute_layout{ aAttribute, aSet, 0, sizeof(T) } };
+			// Log missing attributes from this thread, so that the workers' messages do not interleave:
+			for (const auto& slice : slices) {
+				slice.mModel->log_missing_vertex_attributes({ slice.mMeshIndex }, layout);
+			}
+			avk::thread_pool::shared().parallel_for(slices.size(), [&](size_t i) {
+				const auto& slice = slices[i];
+				const auto n = slice.mModel->write_vertex_data({ slice.mMeshIndex }, layout, destination, slice.mFirstVertex, false);
+				if (nullptr != aTransformFunc && slice.mModel->num_uv_components_for_mesh(slice.mMeshIndex, aSet) > 0) {
+					for (size_t v = slice.mFirstVertex; v < slice.mFirstVertex + n; ++v) {
+						result[v] = aTransformFunc(result[v]);
+					}
+				}
+			});
+			return result;
+		}
+
+		/** Gets bone weights and/or bone indices of all the selected meshes. The meshes are processed in parallel
+		 *	on the shared thread pool, each one writing directly into its slice of the results.
+		 *	@param	aBoneIndexOffsets	One bone index offset per selected mesh (in the order of the selection)
+		 *	@return	Tuple of the bone weights (empty if not requested) and the bone indices (empty if not requested)
+		 */
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_data(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aGetWeights, bool aGetIndices, bool aNormalizeBoneWeights, const std::vector<uint32_t>& aBoneIndexOffsets)
+		{
+			auto [slices, numVertices, numIndices] = compute_mesh_slices(aModelsAndSelectedMeshes, false);
+			assert(aBoneIndexOffsets.size() == slices.size());
+			std::vector<glm::vec4> weights(aGetWeights ? numVertices : 0);
+			std::vector<glm::uvec4> indices(aGetIndices ? numVertices : 0);
+			if (!aGetWeights && !aGetIndices) {
+				return std::make_tuple(std::move(weights), std::move(indices));
+			}
+			// All warnings are logged from this thread, so that the workers' messages do not interleave:
+			for (size_t i = 0; i < slices.size(); ++i) {
+				if (!slices[i].mModel->handle()->mMeshes[slices[i].mMeshIndex]->HasBones()) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights and ({},{},{},{}) bone indices for each vertex.", slices[i].mMeshIndex, aBoneIndexOffsets[i], aBoneIndexOffsets[i], aBoneIndexOffsets[i], aBoneIndexOffsets[i]));
+				}
+			}
+			std::vector<uint8_t> nonNormalized(slices.size(), 0); // not std::vector<bool>, which can't be written concurrently
+			avk::thread_pool::shared().parallel_for(slices.size(), [&](size_t i) {
+				const auto& slice = slices[i];
+				const auto n = slice.mModel->number_of_vertices_for_mesh(slice.mMeshIndex);
+				nonNormalized[i] = slice.mModel->write_bone_weights_and_indices_for_mesh(slice.mMeshIndex,
+					aGetWeights ? std::span<glm::vec4>(weights).subspan(slice.mFirstVertex, n) : std::span<glm::vec4>{},
+					aGetIndices ? std::span<glm::uvec4>(indices).subspan(slice.mFirstVertex, n) : std::span<glm::uvec4>{},
+					aNormalizeBoneWeights, aBoneIndexOffsets[i], false
+				) ? 1 : 0;
+			});
+			for (size_t i = 0; i < slices.size(); ++i) {
+				if (0 != nonNormalized[i]) {
+					LOG_WARNING(fmt::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", slices[i].mMeshIndex));
+				}
+			}
+			return std::make_tuple(std::move(weights), std::move(indices));
+		}
+
+		/** Gets the same bone index offset for every selected mesh */
+		std::vector<uint32_t> constant_bone_index_offsets(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+		{
+			size_t numMeshes = 0;
+			for (auto& pair : aModelsAndSelectedMeshes) {
+				numMeshes += std::get<std::vector<avk::mesh_index_t>>(pair).size();
+			}
+			return std::vector<uint32_t>(numMeshes, aBoneIndexOffset);
+		}
+
+		/** Gets the bone index offset of every selected mesh for the "single target buffer" mode, where the offsets
+		 *	of each model's meshes start at aInitialBoneIndexOffset and accumulate the meshes' numbers of bone matrices.
+		 */
+		std::vector<uint32_t> single_target_buffer_bone_index_offsets(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
+		{
+			std::vector<uint32_t> result;
+			for (auto& pair : aModelsAndSelectedMeshes) {
+				const auto& modelRef = std::get<const avk::model_t&>(pair);
+				uint32_t offset = aInitialBoneIndexOffset;
+				for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+					result.push_back(offset);
+					offset += modelRef.num_bone_matrices(meshIndex);
+				}
+			}
+			return result;
+		}
+
+		/** Gets the bone index offset of every selected mesh for the "single target buffer" mode, where the offset of
+		 *	a mesh is the accumulated number of bone matrices of all the meshes before it in aReferenceMeshIndices.
+		 */
+		std::vector<uint32_t> single_target_buffer_bone_index_offsets(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
+		{
+			std::vector<uint32_t> result;
+			for (auto& pair : aModelsAndSelectedMeshes) {
+				const auto& modelRef = std::get<const avk::model_t&>(pair);
+				for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+					uint32_t offset = 0u;
+					auto it = std::begin(aReferenceMeshIndices);
+					for (; it != std::end(aReferenceMeshIndices) && *it != meshIndex; ++it) {
+						offset += modelRef.num_bone_matrices(*it);
+					}
+					if (std::end(aReferenceMeshIndices) == it) {
+						throw avk::runtime_error("Invalid arguments to get_bone_indices_for_single_target_buffer: The list of aReferenceMeshIndices must contain all selected mesh indices.");
+					}
+					result.push_back(offset);
+				}
+			}
+			return result;
+		}
+
+		/** Converts every element of aSource with the given function, e.g. to quantize vertex attributes.
+		 *	The work is split into chunks which are processed in parallel on the shared thread pool.
+		 */
+		template <typename R, typename T>
+		std::vector<R> convert_in_parallel(const std::vector<T>& aSource, R(*aConvertFunc)(const T&))
+		{
+			constexpr size_t chunkSize = 4096;
+			std::vector<R> result(aSource.size());
+			avk::thread_pool::shared().parallel_for((aSource.size() + chunkSize - 1) / chunkSize, [&](size_t chunk) {
+				const auto end = std::min(aSource.size(), (chunk + 1) * chunkSize);
+				for (size_t i = chunk * chunkSize; i < end; ++i) {
+					result[i] = aConvertFunc(aSource[i]);
+				}
+			});
+			return result;
+		}
+	}
+
 	std::tuple<avk::image, avk::command::action_type_command> create_cubemap_from_image_data_cached(image_data& aImageData, avk::layout::image_layout aImageLayout, avk::memory_usage aMemoryUsage, avk::image_usage aImageUsage, std::optional<std::reference_wrapper<avk::serializer>> aSerializer)
 	{
 		// image must have flag set to be used for cube map
@@ -227,18 +397,28 @@ namespace avk
 
 	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> positionsData;
-		std::vector<uint32_t> indicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				avk::append_indices_and_vertex_data(
-					avk::additional_index_data(	indicesData,	[&]() { return modelRef.indices_for_mesh<uint32_t>(meshIndex);	} ),
-					avk::additional_vertex_data(positionsData,	[&]() { return modelRef.positions_for_mesh(meshIndex);			} )
-				);
+		auto [slices, numVertices, numIndices] = compute_mesh_slices(aModelsAndSelectedMeshes, true);
+		std::vector<glm::vec3> positionsData(numVertices);
+		std::vector<uint32_t> indicesData(numIndices);
+
+		const std::span<std::byte> positionsDestination(reinterpret_cast<std::byte*>(positionsData.data()), positionsData.size() * sizeof(glm::vec3));
+		const std::vector<avk::vertex_attribute_layout> layout{ avk::vertex_attribute_layout{ avk::vertex_attribute::position, 0, 0, sizeof(glm::vec3) } };
+
+		avk::thread_pool::shared().parallel_for(slices.size(), [&](size_t i) {
+			const auto& slice = slices[i];
+			slice.mModel->write_vertex_data({ slice.mMeshIndex }, layout, positionsDestination, slice.mFirstVertex, false);
+
+			// Write the indices into this mesh's slice, rebased to the mesh's first vertex:
+			const aiMesh* paiMesh = slice.mModel->handle()->mMeshes[slice.mMeshIndex];
+			const auto base = static_cast<uint32_t>(slice.mFirstVertex);
+			auto dst = slice.mFirstIndex;
+			for (unsigned int f = 0; f < paiMesh->mNumFaces; ++f) {
+				const aiFace& paiFace = paiMesh->mFaces[f];
+				for (unsigned int k = 0; k < paiFace.mNumIndices; ++k) {
+					indicesData[dst++] = paiFace.mIndices[k] + base;
+				}
 			}
-		}
+		});
 
 		return std::make_tuple( std::move(positionsData), std::move(indicesData) );
 	}
@@ -255,16 +435,7 @@ namespace avk
 
 	std::vector<glm::vec3> get_normals(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> normalsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(normalsData, modelRef.normals_for_mesh(meshIndex));
-			}
-		}
-
-		return normalsData;
+		return get_vertex_attribute<glm::vec3>(aModelsAndSelectedMeshes, avk::vertex_attribute::normal);
 	}
 
 	std::vector<glm::vec3> get_normals_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -280,16 +451,7 @@ namespace avk
 
 	std::vector<glm::vec3> get_tangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> tangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(tangentsData, modelRef.tangents_for_mesh(meshIndex));
-			}
-		}
-
-		return tangentsData;
+		return get_vertex_attribute<glm::vec3>(aModelsAndSelectedMeshes, avk::vertex_attribute::tangent);
 	}
 
 	std::vector<glm::vec3> get_tangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -307,16 +469,7 @@ namespace avk
 
 	std::vector<glm::vec3> get_bitangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> bitangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(bitangentsData, modelRef.bitangents_for_mesh(meshIndex));
-			}
-		}
-
-		return bitangentsData;
+		return get_vertex_attribute<glm::vec3>(aModelsAndSelectedMeshes, avk::vertex_attribute::bitangent);
 	}
 
 	std::vector<glm::vec3> get_bitangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -333,16 +486,7 @@ namespace avk
 
 	std::vector<glm::vec4> get_colors(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
 	{
-		std::vector<glm::vec4> colorsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(colorsData, modelRef.colors_for_mesh(meshIndex, aColorsSet));
-			}
-		}
-
-		return colorsData;
+		return get_vertex_attribute<glm::vec4>(aModelsAndSelectedMeshes, avk::vertex_attribute::color, aColorsSet);
 	}
 
 	std::vector<glm::vec4> get_colors_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
@@ -360,16 +504,7 @@ namespace avk
 
 	std::vector<glm::vec4> get_bone_weights(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
 	{
-		std::vector<glm::vec4> boneWeightsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneWeightsData, modelRef.bone_weights_for_mesh(meshIndex, aNormalizeBoneWeights));
-			}
-		}
-
-		return boneWeightsData;
+		return std::get<0>(get_bone_data(aModelsAndSelectedMeshes, true, false, aNormalizeBoneWeights, constant_bone_index_offsets(aModelsAndSelectedMeshes, 0u)));
 	}
 
 	std::vector<glm::vec4> get_bone_weights_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
@@ -386,16 +521,7 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.bone_indices_for_mesh(meshIndex, aBoneIndexOffset));
-			}
-		}
-
-		return boneIndicesData;
+		return std::get<1>(get_bone_data(aModelsAndSelectedMeshes, false, true, false, constant_bone_index_offsets(aModelsAndSelectedMeshes, aBoneIndexOffset)));
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
@@ -412,14 +538,7 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			insert_into(boneIndicesData, modelRef.bone_indices_for_meshes_for_single_target_buffer(std::get<std::vector<avk::mesh_index_t>>(pair), aInitialBoneIndexOffset));
-		}
-
-		return boneIndicesData;
+		return std::get<1>(get_bone_data(aModelsAndSelectedMeshes, false, true, false, single_target_buffer_bone_index_offsets(aModelsAndSelectedMeshes, aInitialBoneIndexOffset)));
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
@@ -436,16 +555,7 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.bone_indices_for_mesh_for_single_target_buffer(meshIndex, aReferenceMeshIndices));
-			}
-		}
-
-		return boneIndicesData;
+		return std::get<1>(get_bone_data(aModelsAndSelectedMeshes, false, true, false, single_target_buffer_bone_index_offsets(aModelsAndSelectedMeshes, aReferenceMeshIndices)));
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
@@ -460,18 +570,43 @@ namespace avk
 		return boneIndicesData;
 	}
 
-	std::vector<glm::vec2> get_2d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset)
 	{
-		std::vector<glm::vec2> texCoordsData;
+		return get_bone_data(aModelsAndSelectedMeshes, true, true, aNormalizeBoneWeights, constant_bone_index_offsets(aModelsAndSelectedMeshes, aBoneIndexOffset));
+	}
 
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec2>(meshIndex, aTexCoordSet));
-			}
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset)
+	{
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> boneWeightsAndIndicesData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneWeightsAndIndicesData = get_bone_weights_and_indices(aModelsAndSelectedMeshes, aNormalizeBoneWeights, aBoneIndexOffset);
 		}
+		aSerializer.archive(boneWeightsAndIndicesData);
 
-		return texCoordsData;
+		return boneWeightsAndIndicesData;
+	}
+
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices, bool aNormalizeBoneWeights)
+	{
+		return get_bone_data(aModelsAndSelectedMeshes, true, true, aNormalizeBoneWeights, single_target_buffer_bone_index_offsets(aModelsAndSelectedMeshes, aReferenceMeshIndices));
+	}
+
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> get_bone_weights_and_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices, bool aNormalizeBoneWeights)
+	{
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> boneWeightsAndIndicesData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneWeightsAndIndicesData = get_bone_weights_and_indices_for_single_target_buffer(aModelsAndSelectedMeshes, aReferenceMeshIndices, aNormalizeBoneWeights);
+		}
+		aSerializer.archive(boneWeightsAndIndicesData);
+
+		return boneWeightsAndIndicesData;
+	}
+
+	std::vector<glm::vec2> get_2d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		return get_vertex_attribute<glm::vec2>(aModelsAndSelectedMeshes, avk::vertex_attribute::texture_coordinates_2d, aTexCoordSet);
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -488,16 +623,7 @@ namespace avk
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec2> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return get_vertex_attribute<glm::vec2>(aModelsAndSelectedMeshes, avk::vertex_attribute::texture_coordinates_2d, aTexCoordSet, [](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; });
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -513,31 +639,213 @@ namespace avk
 	}
 
 	std::vector<glm::vec3> get_3d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		return get_vertex_attribute<glm::vec3>(aModelsAndSelectedMeshes, avk::vertex_attribute::texture_coordinates_3d, aTexCoordSet);
+	}
+
+	std::vector<glm::vec3> get_3d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
 		std::vector<glm::vec3> texCoordsData;
 
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec3>(meshIndex, aTexCoordSet));
-			}
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			texCoordsData = get_3d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
+		aSerializer.archive(texCoordsData);
 
 		return texCoordsData;
 	}
 
-	std::vector<glm::vec3> get_3d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	std::tuple<std::vector<unorm16x4>, std::vector<position_dequantization>> get_quantized_positions(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds)
 	{
-		std::vector<glm::vec3> texCoordsData;
+		auto [slices, numVertices, numIndices] = compute_mesh_slices(aModelsAndSelectedMeshes, false);
+		if (aPerMeshBounds && slices.size() > static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1) {
+			throw avk::runtime_error(fmt::format("Too many meshes ({}) for per-mesh position quantization, where every mesh's dequantization index is stored in 16 bits.", slices.size()));
+		}
+		const auto positions = get_vertex_attribute<glm::vec3>(aModelsAndSelectedMeshes, avk::vertex_attribute::position);
+
+		// Determine the bounds of every mesh in parallel:
+		std::vector<position_dequantization> dequantization(slices.size());
+		avk::thread_pool::shared().parallel_for(slices.size(), [&](size_t i) {
+			const auto& slice = slices[i];
+			const auto n = slice.mModel->number_of_vertices_for_mesh(slice.mMeshIndex);
+			glm::vec3 minPos{ std::numeric_limits<float>::max() };
+			glm::vec3 maxPos{ std::numeric_limits<float>::lowest() };
+			for (size_t v = slice.mFirstVertex; v < slice.mFirstVertex + n; ++v) {
+				minPos = glm::min(minPos, positions[v]);
+				maxPos = glm::max(maxPos, positions[v]);
+			}
+			dequantization[i] = 0 == n ? make_position_dequantization(glm::vec3{ 0.0f }, glm::vec3{ 0.0f }) : make_position_dequantization(minPos, maxPos);
+		});
+
+		if (!aPerMeshBounds && !dequantization.empty()) {
+			glm::vec3 minPos{ std::numeric_limits<float>::max() };
+			glm::vec3 maxPos{ std::numeric_limits<float>::lowest() };
+			for (size_t i = 0; i < slices.size(); ++i) {
+				if (0 == slices[i].mModel->number_of_vertices_for_mesh(slices[i].mMeshIndex)) {
+					continue;
+				}
+				minPos = glm::min(minPos, glm::vec3{ dequantization[i].mOffset });
+				maxPos = glm::max(maxPos, glm::vec3{ dequantization[i].mOffset + dequantization[i].mScale });
+			}
+			dequantization = { minPos.x <= maxPos.x ? make_position_dequantization(minPos, maxPos) : make_position_dequantization(glm::vec3{ 0.0f }, glm::vec3{ 0.0f }) };
+		}
+
+		std::vector<unorm16x4> result(numVertices);
+		avk::thread_pool::shared().parallel_for(slices.size(), [&](size_t i) {
+			const auto& slice = slices[i];
+			const auto n = slice.mModel->number_of_vertices_for_mesh(slice.mMeshIndex);
+			const auto& deq = aPerMeshBounds ? dequantization[i] : dequantization.front();
+			const auto w = aPerMeshBounds ? static_cast<uint16_t>(i) : uint16_t{ 0 };
+			for (size_t v = slice.mFirstVertex; v < slice.mFirstVertex + n; ++v) {
+				result[v] = quantize_position(positions[v], deq, w);
+			}
+		});
+		return std::make_tuple(std::move(result), std::move(dequantization));
+	}
+
+	std::tuple<std::vector<unorm16x4>, std::vector<position_dequantization>> get_quantized_positions_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aPerMeshBounds)
+	{
+		std::vector<unorm16x4> positionsData;
+		std::vector<position_dequantization> dequantizationData;
 
 		if (aSerializer.mode() == avk::serializer::mode::serialize) {
-			texCoordsData = get_3d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
+			std::tie(positionsData, dequantizationData) = get_quantized_positions(aModelsAndSelectedMeshes, aPerMeshBounds);
+		}
+		aSerializer.archive(positionsData);
+		aSerializer.archive(dequantizationData);
+
+		return std::make_tuple(std::move(positionsData), std::move(dequantizationData));
+	}
+
+	std::vector<snorm16x2> get_octahedral_normals(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		return convert_in_parallel(get_normals(aModelsAndSelectedMeshes), &encode_octahedral);
+	}
+
+	std::vector<snorm16x2> get_octahedral_normals_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<snorm16x2> normalsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			normalsData = get_octahedral_normals(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(normalsData);
+
+		return normalsData;
+	}
+
+	std::vector<snorm16x2> get_octahedral_tangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		return convert_in_parallel(get_tangents(aModelsAndSelectedMeshes), &encode_octahedral);
+	}
+
+	std::vector<snorm16x2> get_octahedral_tangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<snorm16x2> tangentsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			tangentsData = get_octahedral_tangents(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(tangentsData);
+
+		return tangentsData;
+	}
+
+	std::vector<float16x2> get_half_precision_2d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipY)
+	{
+		return convert_in_parallel(
+			aFlipY ? get_2d_texture_coordinates_flipped(aModelsAndSelectedMeshes, aTexCoordSet) : get_2d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet),
+			&to_float16x2
+		);
+	}
+
+	std::vector<float16x2> get_half_precision_2d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipY)
+	{
+		std::vector<float16x2> texCoordsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			texCoordsData = get_half_precision_2d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet, aFlipY);
 		}
 		aSerializer.archive(texCoordsData);
 
 		return texCoordsData;
 	}
 
+	std::vector<unorm8x4> get_quantized_bone_weights(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
+	{
+		return convert_in_parallel(get_bone_weights(aModelsAndSelectedMeshes, aNormalizeBoneWeights), &quantize_bone_weights);
+	}
+
+	std::vector<unorm8x4> get_quantized_bone_weights_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
+	{
+		std::vector<unorm8x4> boneWeightsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneWeightsData = get_quantized_bone_weights(aModelsAndSelectedMeshes, aNormalizeBoneWeights);
+		}
+		aSerializer.archive(boneWeightsData);
+
+		return boneWeightsData;
+	}
+
+	std::vector<glm::u8vec4> get_bone_indices_uint8(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+	{
+		return convert_in_parallel(get_bone_indices(aModelsAndSelectedMeshes, aBoneIndexOffset), &narrow_bone_indices<glm::u8vec4>);
+	}
+
+	std::vector<glm::u8vec4> get_bone_indices_uint8_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+	{
+		std::vector<glm::u8vec4> boneIndicesData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneIndicesData = get_bone_indices_uint8(aModelsAndSelectedMeshes, aBoneIndexOffset);
+		}
+		aSerializer.archive(boneIndicesData);
+
+		return boneIndicesData;
+	}
+
+	std::vector<glm::u16vec4> get_bone_indices_uint16(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+	{
+		return convert_in_parallel(get_bone_indices(aModelsAndSelectedMeshes, aBoneIndexOffset), &narrow_bone_indices<glm::u16vec4>);
+	}
+
+	std::vector<glm::u16vec4> get_bone_indices_uint16_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
+	{
+		std::vector<glm::u16vec4> boneIndicesData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boneIndicesData = get_bone_indices_uint16(aModelsAndSelectedMeshes, aBoneIndexOffset);
+		}
+		aSerializer.archive(boneIndicesData);
+
+		return boneIndicesData;
+	}
+
+	std::vector<bounding_volume_gpu_data> get_bounding_volumes(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<bounding_volume_gpu_data> result;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<const avk::model_t&>(pair);
+			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+				result.push_back(to_gpu_data(modelRef.bounding_box_for_mesh(meshIndex), modelRef.bounding_sphere_for_mesh(meshIndex)));
+			}
+		}
+		return result;
+	}
+
+	std::vector<bounding_volume_gpu_data> get_bounding_volumes_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<bounding_volume_gpu_data> boundingVolumesData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			boundingVolumesData = get_bounding_volumes(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(boundingVolumesData);
+
+		return boundingVolumesData;
+	}
+
 	avk::sampler create_sampler_cached(avk::serializer& aSerializer, avk::filter_mode aFilterMode, std::array<avk::border_handling_mode, 3> aBorderHandlingModes, float aMipMapMaxLod, std::function<void(avk::sampler_t&)> aAlterConfigBeforeCreation)
 	{
 		aSerializer.archive(aFilterMode);
@@ -0,0 +1,412 @@
+#include <numeric>
+
+#include "mesh_optimization_helpers.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		void validate_triangle_list(const std::vector<uint32_t>& aIndices, size_t aNumVertices)
+		{
+			if (aIndices.size() % 3 != 0) {
+				throw avk::runtime_error(fmt::format("The number of indices ({}) is not a multiple of three. Only triangle lists are supported.", aIndices.size()));
+			}
+			for (auto index : aIndices) {
+				if (index >= aNumVertices) {
+					throw avk::runtime_error(fmt::format("Index {} is out of range for {} vertices.", index, aNumVertices));
+				}
+			}
+		}
+
+		/** FIFO cache simulation based on timestamps: A vertex is in the cache if it has been
+		 *	inserted less than mCacheSize misses ago. */
+		struct fifo_cache_simulation
+		{
+			fifo_cache_simulation(size_t aNumVertices, uint32_t aCacheSize)
+				: mTimestamps(aNumVertices, 0u)
+				, mCacheSize{ aCacheSize }
+				, mTimestamp{ aCacheSize + 1u }
+			{}
+
+			/** Makes all vertices cache misses again */
+			void reset()
+			{
+				mTimestamp += mCacheSize + 1u;
+			}
+
+			/** Processes a triangle and returns the number of cache misses it has caused */
+			uint32_t process(uint32_t aA, uint32_t aB, uint32_t aC)
+			{
+				uint32_t misses = 0u;
+				for (auto v : { aA, aB, aC }) {
+					if (mTimestamp - mTimestamps[v] > mCacheSize) {
+						mTimestamps[v] = mTimestamp++;
+						++misses;
+					}
+				}
+				return misses;
+			}
+
+			std::vector<uint32_t> mTimestamps;
+			uint32_t mCacheSize;
+			uint32_t mTimestamp;
+		};
+
+		// Parameters of Forsyth's scoring function:
+		constexpr size_t sForsythCacheSize = 32;
+		constexpr float sForsythLastTriangleScore = 0.75f;
+		constexpr float sForsythCacheDecayPower = 1.5f;
+		constexpr float sForsythValenceBoostScale = 2.0f;
+		constexpr float sForsythValenceBoostPower = 0.5f;
+
+		float forsyth_vertex_score(int aCachePosition, uint32_t aRemainingValence)
+		{
+			if (0u == aRemainingValence) {
+				return -1.0f; // => Not used by any remaining triangle
+			}
+			float score = 0.0f;
+			if (aCachePosition >= 0) {
+				if (aCachePosition < 3) {
+					// Vertices of the last triangle get a fixed score, in order to not favor any of its edges:
+					score = sForsythLastTriangleScore;
+				}
+				else {
+					const float scaler = 1.0f / static_cast<float>(sForsythCacheSize - 3u);
+					score = std::pow(1.0f - static_cast<float>(aCachePosition - 3) * scaler, sForsythCacheDecayPower);
+				}
+			}
+			// Boost vertices with only few remaining triangles, so that they are finished off quickly:
+			score += sForsythValenceBoostScale * std::pow(static_cast<float>(aRemainingValence), -sForsythValenceBoostPower);
+			return score;
+		}
+	}
+
+	vertex_cache_statistics analyze_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices, uint32_t aCacheSize)
+	{
+		validate_triangle_list(aIndices, aNumVertices);
+
+		vertex_cache_statistics result;
+		if (aIndices.empty()) {
+			return result;
+		}
+
+		fifo_cache_simulation cache(aNumVertices, aCacheSize);
+		for (size_t i = 0; i < aIndices.size(); i += 3) {
+			result.mVerticesTransformed += cache.process(aIndices[i], aIndices[i + 1], aIndices[i + 2]);
+		}
+
+		std::vector<bool> referenced(aNumVertices, false);
+		size_t numReferenced = 0;
+		for (auto index : aIndices) {
+			if (!referenced[index]) {
+				referenced[index] = true;
+				++numReferenced;
+			}
+		}
+
+		result.mAcmr = static_cast<float>(result.mVerticesTransformed) / static_cast<float>(aIndices.size() / 3);
+		result.mAtvr = static_cast<float>(result.mVerticesTransformed) / static_cast<float>(numReferenced);
+		return result;
+	}
+
+	std::vector<uint32_t> optimize_vertex_cache(const std::vector<uint32_t>& aIndices, size_t aNumVertices)
+	{
+		validate_triangle_list(aIndices, aNumVertices);
+
+		const size_t numTriangles = aIndices.size() / 3;
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		if (0 == numTriangles) {
+			return result;
+		}
+
+		// Build vertex => triangles adjacency in a compressed layout:
+		std::vector<uint32_t> remainingValence(aNumVertices, 0u);
+		for (auto index : aIndices) {
+			++remainingValence[index];
+		}
+		std::vector<size_t> adjacencyOffsets(aNumVertices + 1, 0);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remainingValence[v];
+		}
+		std::vector<uint32_t> adjacency(aIndices.size());
+		{
+			std::vector<size_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (size_t i = 0; i < aIndices.size(); ++i) {
+				adjacency[fill[aIndices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+
+		std::vector<int> cachePosition(aNumVertices, -1);
+		std::vector<float> vertexScore(aNumVertices);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			vertexScore[v] = forsyth_vertex_score(-1, remainingValence[v]);
+		}
+		std::vector<float> triangleScore(numTriangles);
+		std::vector<bool> emitted(numTriangles, false);
+		std::optional<size_t> bestTriangle;
+		float bestScore = -1.0f;
+		for (size_t t = 0; t < numTriangles; ++t) {
+			triangleScore[t] = vertexScore[aIndices[3 * t]] + vertexScore[aIndices[3 * t + 1]] + vertexScore[aIndices[3 * t + 2]];
+			if (triangleScore[t] > bestScore) {
+				bestScore = triangleScore[t];
+				bestTriangle = t;
+			}
+		}
+
+		std::vector<uint32_t> cache;
+		cache.reserve(sForsythCacheSize + 3);
+		std::vector<uint32_t> newCache;
+		newCache.reserve(sForsythCacheSize + 3);
+		size_t inputCursor = 0; // => Fallback if no triangle adjacent to the cache remains
+
+		for (size_t n = 0; n < numTriangles; ++n) {
+			if (!bestTriangle.has_value()) {
+				while (emitted[inputCursor]) {
+					++inputCursor;
+				}
+				bestTriangle = inputCursor;
+			}
+			const auto t = bestTriangle.value();
+			const uint32_t* tri = &aIndices[3 * t];
+
+			emitted[t] = true;
+			result.insert(result.end(), tri, tri + 3);
+
+			// Remove the triangle from its vertices' adjacency lists:
+			for (int k = 0; k < 3; ++k) {
+				const auto v = tri[k];
+				auto* begin = adjacency.data() + adjacencyOffsets[v];
+				auto* end = begin + remainingValence[v];
+				auto* it = std::find(begin, end, static_cast<uint32_t>(t));
+				assert(it != end);
+				std::swap(*it, *(end - 1));
+				--remainingValence[v];
+			}
+
+			// Move the triangle's vertices to the front of the (LRU) cache:
+			newCache.clear();
+			for (int k = 0; k < 3; ++k) {
+				if (std::find(newCache.begin(), newCache.end(), tri[k]) == newCache.end()) {
+					newCache.push_back(tri[k]);
+				}
+			}
+			for (auto v : cache) {
+				if (v != tri[0] && v != tri[1] && v != tri[2]) {
+					newCache.push_back(v);
+				}
+			}
+
+			// Update the scores of all vertices which have been in the cache or just left it:
+			for (size_t i = 0; i < newCache.size(); ++i) {
+				const auto v = newCache[i];
+				cachePosition[v] = i < sForsythCacheSize ? static_cast<int>(i) : -1;
+				vertexScore[v] = forsyth_vertex_score(cachePosition[v], remainingValence[v]);
+			}
+
+			// Update the affected triangles and find the best candidate for the next iteration:
+			bestTriangle.reset();
+			bestScore = -1.0f;
+			for (auto v : newCache) {
+				const auto* begin = adjacency.data() + adjacencyOffsets[v];
+				const auto* end = begin + remainingValence[v];
+				for (auto* it = begin; it != end; ++it) {
+					const auto at = *it;
+					triangleScore[at] = vertexScore[aIndices[3 * at]] + vertexScore[aIndices[3 * at + 1]] + vertexScore[aIndices[3 * at + 2]];
+					if (triangleScore[at] > bestScore) {
+						bestScore = triangleScore[at];
+						bestTriangle = at;
+					}
+				}
+			}
+
+			if (newCache.size() > sForsythCacheSize) {
+				newCache.resize(sForsythCacheSize);
+			}
+			std::swap(cache, newCache);
+		}
+
+		return result;
+	}
+
+	std::vector<uint32_t> optimize_overdraw(const std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aPositions, float aThreshold, uint32_t aCacheSize)
+	{
+		validate_triangle_list(aIndices, aPositions.size());
+
+		const size_t numTriangles = aIndices.size() / 3;
+		if (0 == numTriangles) {
+			return {};
+		}
+
+		fifo_cache_simulation cache(aPositions.size(), aCacheSize);
+
+		// Hard boundaries: triangles where the cache has to start over anyways (all three vertices miss):
+		std::vector<size_t> hardBoundaries;
+		for (size_t t = 0; t < numTriangles; ++t) {
+			if (3u == cache.process(aIndices[3 * t], aIndices[3 * t + 1], aIndices[3 * t + 2]) || 0 == t) {
+				hardBoundaries.push_back(t);
+			}
+		}
+		hardBoundaries.push_back(numTriangles);
+
+		// Soft boundaries: split the hard clusters further wherever the ACMR of the cluster-so-far,
+		// with a cold cache, stays within the permitted threshold of the whole cluster's ACMR:
+		std::vector<size_t> clusterBegins;
+		for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+			const auto begin = hardBoundaries[h];
+			const auto end = hardBoundaries[h + 1];
+
+			cache.reset();
+			uint32_t clusterMisses = 0u;
+			for (size_t t = begin; t < end; ++t) {
+				clusterMisses += cache.process(aIndices[3 * t], aIndices[3 * t + 1], aIndices[3 * t + 2]);
+			}
+			const float clusterThreshold = aThreshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+			clusterBegins.push_back(begin);
+			cache.reset();
+			uint32_t runningMisses = 0u;
+			uint32_t runningTriangles = 0u;
+			for (size_t t = begin; t < end; ++t) {
+				runningMisses += cache.process(aIndices[3 * t], aIndices[3 * t + 1], aIndices[3 * t + 2]);
+				++runningTriangles;
+				if (t + 1 < end && static_cast<float>(runningMisses) / static_cast<float>(runningTriangles) <= clusterThreshold) {
+					clusterBegins.push_back(t + 1);
+					cache.reset();
+					runningMisses = 0u;
+					runningTriangles = 0u;
+				}
+			}
+		}
+		const auto numClusters = clusterBegins.size();
+		clusterBegins.push_back(numTriangles);
+
+		// Area-weighted centroid of the whole mesh:
+		glm::vec3 meshCentroid{ 0.0f };
+		float meshArea = 0.0f;
+		std::vector<glm::vec3> clusterCentroids(numClusters, glm::vec3{ 0.0f });
+		std::vector<glm::vec3> clusterNormals(numClusters, glm::vec3{ 0.0f });
+		for (size_t c = 0; c < numClusters; ++c) {
+			float clusterArea = 0.0f;
+			for (size_t t = clusterBegins[c]; t < clusterBegins[c + 1]; ++t) {
+				const auto& p0 = aPositions[aIndices[3 * t]];
+				const auto& p1 = aPositions[aIndices[3 * t + 1]];
+				const auto& p2 = aPositions[aIndices[3 * t + 2]];
+				const auto n = glm::cross(p1 - p0, p2 - p0);
+				const auto area = glm::length(n);
+				const auto centroid = (p0 + p1 + p2) / 3.0f;
+				clusterCentroids[c] += centroid * area;
+				clusterNormals[c] += n;
+				clusterArea += area;
+			}
+			meshCentroid += clusterCentroids[c];
+			meshArea += clusterArea;
+			if (clusterArea > 0.0f) {
+				clusterCentroids[c] /= clusterArea;
+			}
+			const auto normalLength = glm::length(clusterNormals[c]);
+			if (normalLength > 0.0f) {
+				clusterNormals[c] /= normalLength;
+			}
+		}
+		if (meshArea > 0.0f) {
+			meshCentroid /= meshArea;
+		}
+
+		// Clusters which face outwards the most are drawn first, since they are the most likely occluders:
+		std::vector<float> sortKeys(numClusters);
+		for (size_t c = 0; c < numClusters; ++c) {
+			sortKeys[c] = glm::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c]);
+		}
+		std::vector<size_t> clusterOrder(numClusters);
+		std::iota(clusterOrder.begin(), clusterOrder.end(), size_t{ 0 });
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		for (auto c : clusterOrder) {
+			result.insert(result.end(), aIndices.begin() + 3 * clusterBegins[c], aIndices.begin() + 3 * clusterBegins[c + 1]);
+		}
+		return result;
+	}
+
+	std::tuple<std::vector<uint32_t>, size_t> optimize_vertex_fetch_remap(const std::vector<uint32_t>& aIndices, size_t aNumVertices)
+	{
+		validate_triangle_list(aIndices, aNumVertices);
+
+		std::vector<uint32_t> remap(aNumVertices, mesh_optimization_result::sUnusedVertex);
+		uint32_t next = 0u;
+		for (auto index : aIndices) {
+			if (mesh_optimization_result::sUnusedVertex == remap[index]) {
+				remap[index] = next++;
+			}
+		}
+		return std::make_tuple(std::move(remap), static_cast<size_t>(next));
+	}
+
+	std::vector<uint32_t> remap_index_buffer(const std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aVertexRemap)
+	{
+		if (aVertexRemap.empty()) {
+			return aIndices;
+		}
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		for (auto index : aIndices) {
+			assert(index < aVertexRemap.size() && mesh_optimization_result::sUnusedVertex != aVertexRemap[index]);
+			result.push_back(aVertexRemap[index]);
+		}
+		return result;
+	}
+
+	mesh_optimization_result optimize_mesh(const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const mesh_optimization_config& aConfig)
+	{
+		mesh_optimization_result result;
+		result.mStatisticsBefore = analyze_vertex_cache(aIndices, aPositions.size(), aConfig.mCacheSize);
+		result.mNumVertices = aPositions.size();
+
+		if (aConfig.mOptimizeVertexCache) {
+			result.mIndices = optimize_vertex_cache(aIndices, aPositions.size());
+			if (aConfig.mOptimizeOverdraw) {
+				result.mIndices = optimize_overdraw(result.mIndices, aPositions, aConfig.mOverdrawThreshold, aConfig.mCacheSize);
+			}
+		}
+		else {
+			result.mIndices = aIndices;
+		}
+
+		if (aConfig.mOptimizeVertexFetch) {
+			std::tie(result.mVertexRemap, result.mNumVertices) = optimize_vertex_fetch_remap(result.mIndices, aPositions.size());
+			result.mIndices = remap_index_buffer(result.mIndices, result.mVertexRemap);
+		}
+
+		result.mStatisticsAfter = analyze_vertex_cache(result.mIndices, result.mNumVertices, aConfig.mCacheSize);
+		LOG_DEBUG(fmt::format("Mesh optimization: ACMR {:.3f} => {:.3f}, ATVR {:.3f} => {:.3f}",
+			result.mStatisticsBefore.mAcmr, result.mStatisticsAfter.mAcmr, result.mStatisticsBefore.mAtvr, result.mStatisticsAfter.mAtvr));
+		return result;
+	}
+
+	mesh_optimization_result optimize_mesh(const model_t& aModel, mesh_index_t aMeshIndex, const mesh_optimization_config& aConfig)
+	{
+		return optimize_mesh(aModel.positions_for_mesh(aMeshIndex), aModel.indices_for_mesh<uint32_t>(aMeshIndex), aConfig);
+	}
+
+	mesh_optimization_result optimize_mesh_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<uint32_t>& aIndices, const mesh_optimization_config& aConfig)
+	{
+		mesh_optimization_result result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = optimize_mesh(aPositions, aIndices, aConfig);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+
+	mesh_optimization_result optimize_mesh_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const mesh_optimization_config& aConfig)
+	{
+		mesh_optimization_result result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = optimize_mesh(aModel, aMeshIndex, aConfig);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+}
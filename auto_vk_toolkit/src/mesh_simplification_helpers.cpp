@@ -0,0 +1,477 @@
+#include "mesh_simplification_helpers.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		/** Symmetric 4x4 error quadric (Garland and Heckbert), stored as the upper 3x3 matrix A,
+		 *	the vector b, and the constant c, s.t. the error of a point p is p^T A p + 2 b^T p + c.
+		 *	mWeight accumulates the weights of all planes, which are used for normalization. */
+		struct quadric
+		{
+			double mA00 = 0.0, mA11 = 0.0, mA22 = 0.0, mA01 = 0.0, mA02 = 0.0, mA12 = 0.0;
+			double mB0 = 0.0, mB1 = 0.0, mB2 = 0.0;
+			double mC = 0.0;
+			double mWeight = 0.0;
+
+			quadric& operator+=(const quadric& aOther)
+			{
+				mA00 += aOther.mA00; mA11 += aOther.mA11; mA22 += aOther.mA22;
+				mA01 += aOther.mA01; mA02 += aOther.mA02; mA12 += aOther.mA12;
+				mB0 += aOther.mB0; mB1 += aOther.mB1; mB2 += aOther.mB2;
+				mC += aOther.mC;
+				mWeight += aOther.mWeight;
+				return *this;
+			}
+		};
+
+		/** Creates the quadric of the plane through aPoint with the unit normal aNormal */
+		quadric plane_quadric(const glm::dvec3& aNormal, const glm::dvec3& aPoint, double aWeight)
+		{
+			const auto d = -glm::dot(aNormal, aPoint);
+			quadric q;
+			q.mA00 = aWeight * aNormal.x * aNormal.x; q.mA11 = aWeight * aNormal.y * aNormal.y; q.mA22 = aWeight * aNormal.z * aNormal.z;
+			q.mA01 = aWeight * aNormal.x * aNormal.y; q.mA02 = aWeight * aNormal.x * aNormal.z; q.mA12 = aWeight * aNormal.y * aNormal.z;
+			q.mB0 = aWeight * aNormal.x * d; q.mB1 = aWeight * aNormal.y * d; q.mB2 = aWeight * aNormal.z * d;
+			q.mC = aWeight * d * d;
+			q.mWeight = aWeight;
+			return q;
+		}
+
+		/** Evaluates the quadric at the given point, normalized by its weight, which yields the
+		 *	weighted mean of the squared distances to all of the quadric's planes. */
+		double evaluate(const quadric& aQuadric, const glm::dvec3& aPoint)
+		{
+			if (aQuadric.mWeight <= 0.0) {
+				return 0.0;
+			}
+			const auto& p = aPoint;
+			const auto r =
+				aQuadric.mA00 * p.x * p.x + aQuadric.mA11 * p.y * p.y + aQuadric.mA22 * p.z * p.z
+				+ 2.0 * (aQuadric.mA01 * p.x * p.y + aQuadric.mA02 * p.x * p.z + aQuadric.mA12 * p.y * p.z)
+				+ 2.0 * (aQuadric.mB0 * p.x + aQuadric.mB1 * p.y + aQuadric.mB2 * p.z)
+				+ aQuadric.mC;
+			return std::abs(r) / aQuadric.mWeight;
+		}
+
+		enum struct vertex_kind : uint8_t
+		{
+			/** Interior vertex, which can be collapsed onto any neighbor */
+			manifold,
+			/** Vertex on an open border, which can only be collapsed along the border */
+			border,
+			/** Vertex which must stay in place: on an attribute seam, on a non-manifold edge, or on a locked border */
+			locked
+		};
+
+		/** A candidate for collapsing all vertices at position mFrom onto the vertex mTo */
+		struct edge_collapse
+		{
+			uint32_t mFrom; // canonical vertex
+			uint32_t mTo;   // actual vertex
+			double mCost;   // geometric error plus attribute differences, determines the order of collapses
+			double mError;  // geometric error only
+			bool mAlongBorder;
+		};
+
+		uint64_t edge_key(uint32_t aA, uint32_t aB)
+		{
+			return aA < aB ? (static_cast<uint64_t>(aA) << 32) | aB : (static_cast<uint64_t>(aB) << 32) | aA;
+		}
+
+		/** Counts how many triangles every (undirected) edge belongs to */
+		std::unordered_map<uint64_t, uint32_t> count_edges(const std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aCanonical)
+		{
+			std::unordered_map<uint64_t, uint32_t> edgeCounts;
+			edgeCounts.reserve(aIndices.size());
+			for (size_t t = 0; t < aIndices.size(); t += 3) {
+				for (size_t e = 0; e < 3; ++e) {
+					++edgeCounts[edge_key(aCanonical[aIndices[t + e]], aCanonical[aIndices[t + (e + 1) % 3]])];
+				}
+			}
+			return edgeCounts;
+		}
+
+		/** Stateful simplification of one triangle list, which is simplified further with every call to simplify_to. */
+		class simplifier
+		{
+		public:
+			simplifier(const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords, const std::vector<uint32_t>& aIndices, const lod_generation_config& aConfig)
+				: mNumVertices{ aPositions.size() }
+				, mConfig{ aConfig }
+			{
+				// Normalize positions to the unit cube, s.t. errors are relative to the mesh's extent:
+				glm::vec3 minPos{ std::numeric_limits<float>::max() };
+				glm::vec3 maxPos{ std::numeric_limits<float>::lowest() };
+				for (const auto& p : aPositions) {
+					minPos = glm::min(minPos, p);
+					maxPos = glm::max(maxPos, p);
+				}
+				const auto size = maxPos - minPos;
+				mExtent = aPositions.empty() ? 0.0f : glm::max(size.x, glm::max(size.y, size.z));
+				const auto invExtent = mExtent > 0.0f ? 1.0 / static_cast<double>(mExtent) : 0.0;
+				mPositions.resize(mNumVertices);
+				for (size_t i = 0; i < mNumVertices; ++i) {
+					mPositions[i] = glm::dvec3{ aPositions[i] - minPos } * invExtent;
+				}
+
+				// Attributes are weighted s.t. their differences are comparable to distances in the unit cube:
+				mAttributes.resize(mNumVertices, std::array<float, 5>{});
+				for (size_t i = 0; i < mNumVertices; ++i) {
+					if (!aNormals.empty()) {
+						const auto n = aNormals[i] * aConfig.mNormalWeight;
+						mAttributes[i][0] = n.x; mAttributes[i][1] = n.y; mAttributes[i][2] = n.z;
+					}
+					if (!aTexCoords.empty()) {
+						const auto uv = aTexCoords[i] * aConfig.mTexCoordWeight;
+						mAttributes[i][3] = uv.x; mAttributes[i][4] = uv.y;
+					}
+				}
+
+				// All vertices at the same position are represented by the first one of them:
+				mCanonical.resize(mNumVertices);
+				std::unordered_map<std::tuple<float, float, float>, uint32_t, tuple_hash> firstVertexAt;
+				firstVertexAt.reserve(mNumVertices);
+				for (uint32_t i = 0; i < static_cast<uint32_t>(mNumVertices); ++i) {
+					const auto [it, inserted] = firstVertexAt.try_emplace(std::make_tuple(aPositions[i].x, aPositions[i].y, aPositions[i].z), i);
+					mCanonical[i] = it->second;
+				}
+
+				mIndices.reserve(aIndices.size());
+				for (size_t t = 0; t < aIndices.size(); t += 3) {
+					append_triangle_if_not_degenerate(mIndices, aIndices[t], aIndices[t + 1], aIndices[t + 2]);
+				}
+
+				classify_vertices();
+				compute_quadrics();
+			}
+
+			const std::vector<uint32_t>& indices() const { return mIndices; }
+			float extent() const { return mExtent; }
+			/** The maximum geometric error of all collapses performed so far, relative to the mesh's extent */
+			float relative_error() const { return static_cast<float>(std::sqrt(mMaxError)); }
+
+			/** Collapses edges until the target index count is reached or until no more
+			 *	collapses are possible within the configured maximum error. */
+			void simplify_to(size_t aTargetIndexCount)
+			{
+				while (mIndices.size() > aTargetIndexCount) {
+					if (0 == collapse_edges((mIndices.size() - aTargetIndexCount) / 3)) {
+						break;
+					}
+				}
+			}
+
+		private:
+			struct tuple_hash
+			{
+				size_t operator()(const std::tuple<float, float, float>& aValue) const
+				{
+					const auto h0 = std::hash<float>{}(std::get<0>(aValue));
+					const auto h1 = std::hash<float>{}(std::get<1>(aValue));
+					const auto h2 = std::hash<float>{}(std::get<2>(aValue));
+					return h0 ^ (h1 * 0x9E3779B97F4A7C15ull) ^ (h2 * 0xC2B2AE3D27D4EB4Full);
+				}
+			};
+
+			void append_triangle_if_not_degenerate(std::vector<uint32_t>& aIndices, uint32_t aA, uint32_t aB, uint32_t aC) const
+			{
+				const auto a = mCanonical[aA], b = mCanonical[aB], c = mCanonical[aC];
+				if (a != b && b != c && a != c) {
+					aIndices.push_back(aA);
+					aIndices.push_back(aB);
+					aIndices.push_back(aC);
+				}
+			}
+
+			double attribute_distance_sq(uint32_t aA, uint32_t aB) const
+			{
+				double result = 0.0;
+				for (size_t k = 0; k < 5; ++k) {
+					const double d = mAttributes[aA][k] - mAttributes[aB][k];
+					result += d * d;
+				}
+				return result;
+			}
+
+			void classify_vertices()
+			{
+				mKinds.assign(mNumVertices, vertex_kind::manifold);
+
+				// Vertices at the same position with different attributes form a seam:
+				for (uint32_t i = 0; i < static_cast<uint32_t>(mNumVertices); ++i) {
+					if (mCanonical[i] != i && attribute_distance_sq(i, mCanonical[i]) > 1e-12) {
+						mKinds[mCanonical[i]] = vertex_kind::locked;
+					}
+				}
+
+				// Edges which belong to exactly one triangle are border edges; edges with more than two are non-manifold:
+				std::vector<uint32_t> borderEdgeCounts(mNumVertices, 0u);
+				for (const auto& [key, count] : count_edges(mIndices, mCanonical)) {
+					const auto a = static_cast<uint32_t>(key >> 32);
+					const auto b = static_cast<uint32_t>(key & 0xFFFFFFFFull);
+					if (1u == count) {
+						++borderEdgeCounts[a];
+						++borderEdgeCounts[b];
+					}
+					else if (count > 2u) {
+						mKinds[a] = mKinds[b] = vertex_kind::locked;
+					}
+				}
+				for (size_t i = 0; i < mNumVertices; ++i) {
+					if (vertex_kind::locked == mKinds[i] || 0u == borderEdgeCounts[i]) {
+						continue;
+					}
+					// Only simple border vertices (exactly two border edges) can slide along the border:
+					mKinds[i] = 2u == borderEdgeCounts[i] && !mConfig.mLockBorders ? vertex_kind::border : vertex_kind::locked;
+				}
+			}
+
+			void compute_quadrics()
+			{
+				constexpr double borderWeight = 10.0;
+				mQuadrics.assign(mNumVertices, quadric{});
+				const auto edgeCounts = count_edges(mIndices, mCanonical);
+				for (size_t t = 0; t < mIndices.size(); t += 3) {
+					const uint32_t c[3] = { mCanonical[mIndices[t]], mCanonical[mIndices[t + 1]], mCanonical[mIndices[t + 2]] };
+					const auto n = glm::cross(mPositions[c[1]] - mPositions[c[0]], mPositions[c[2]] - mPositions[c[0]]);
+					const auto len = glm::length(n);
+					if (len <= 0.0) {
+						continue;
+					}
+					const auto normal = n / len;
+					const auto q = plane_quadric(normal, mPositions[c[0]], 0.5 * len);
+					for (auto v : c) {
+						mQuadrics[v] += q;
+					}
+
+					// Border edges get an additional plane which is perpendicular to the triangle, in order to preserve the border's shape:
+					for (size_t e = 0; e < 3; ++e) {
+						const auto a = c[e], b = c[(e + 1) % 3];
+						if (1u != edgeCounts.at(edge_key(a, b))) {
+							continue;
+						}
+						const auto edge = mPositions[b] - mPositions[a];
+						const auto edgeLength = glm::length(edge);
+						if (edgeLength <= 0.0) {
+							continue;
+						}
+						const auto bq = plane_quadric(glm::normalize(glm::cross(edge, normal)), mPositions[a], borderWeight * edgeLength * edgeLength);
+						mQuadrics[a] += bq;
+						mQuadrics[b] += bq;
+					}
+				}
+			}
+
+			/** Tests whether moving the (canonical) vertex aFrom to the position of aTo would flip any of its triangles */
+			bool would_flip_triangles(uint32_t aFrom, uint32_t aTo, const std::vector<uint32_t>& aTriangleOffsets, const std::vector<uint32_t>& aTriangles) const
+			{
+				for (auto i = aTriangleOffsets[aFrom]; i < aTriangleOffsets[aFrom + 1]; ++i) {
+					const auto t = aTriangles[i];
+					glm::dvec3 p[3];
+					glm::dvec3 pMoved[3];
+					bool containsTo = false;
+					for (size_t k = 0; k < 3; ++k) {
+						const auto c = mCanonical[mIndices[3 * t + k]];
+						containsTo = containsTo || c == aTo;
+						p[k] = mPositions[c];
+						pMoved[k] = c == aFrom ? mPositions[aTo] : p[k];
+					}
+					if (containsTo) {
+						continue; // => This triangle will be removed by the collapse
+					}
+					const auto nBefore = glm::cross(p[1] - p[0], p[2] - p[0]);
+					const auto nAfter = glm::cross(pMoved[1] - pMoved[0], pMoved[2] - pMoved[0]);
+					if (glm::dot(nBefore, nAfter) <= 0.0) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/** Performs one pass of independent edge collapses in the order of their costs.
+			 *	@return	The number of collapses performed */
+			size_t collapse_edges(size_t aTrianglesToRemove)
+			{
+				// Triangles adjacent to each canonical vertex:
+				std::vector<uint32_t> triangleOffsets(mNumVertices + 1, 0u);
+				for (auto index : mIndices) {
+					++triangleOffsets[mCanonical[index] + 1];
+				}
+				for (size_t i = 0; i < mNumVertices; ++i) {
+					triangleOffsets[i + 1] += triangleOffsets[i];
+				}
+				std::vector<uint32_t> triangles(mIndices.size());
+				{
+					auto insertPositions = triangleOffsets;
+					for (size_t i = 0; i < mIndices.size(); ++i) {
+						triangles[insertPositions[mCanonical[mIndices[i]]]++] = static_cast<uint32_t>(i / 3);
+					}
+				}
+
+				const auto edgeCounts = count_edges(mIndices, mCanonical);
+				const auto maxError = static_cast<double>(mConfig.mMaxError) * static_cast<double>(mConfig.mMaxError);
+
+				std::vector<edge_collapse> candidates;
+				candidates.reserve(mIndices.size());
+				for (size_t t = 0; t < mIndices.size(); t += 3) {
+					for (size_t e = 0; e < 3; ++e) {
+						const uint32_t i[2] = { mIndices[t + e], mIndices[t + (e + 1) % 3] };
+						const uint32_t c[2] = { mCanonical[i[0]], mCanonical[i[1]] };
+						const bool isBorderEdge = 1u == edgeCounts.at(edge_key(c[0], c[1]));
+						std::optional<edge_collapse> best;
+						for (size_t from = 0; from < 2; ++from) {
+							const auto to = 1 - from;
+							const auto kindFrom = mKinds[c[from]];
+							const bool canCollapse = vertex_kind::manifold == kindFrom
+								|| (vertex_kind::border == kindFrom && isBorderEdge && vertex_kind::manifold != mKinds[c[to]]);
+							if (!canCollapse) {
+								continue;
+							}
+							const auto error = evaluate(mQuadrics[c[from]], mPositions[c[to]]);
+							const auto cost = error + attribute_distance_sq(i[from], i[to]);
+							if (!best.has_value() || cost < best->mCost) {
+								best = edge_collapse{ c[from], i[to], cost, error, isBorderEdge };
+							}
+						}
+						if (best.has_value() && best->mError <= maxError) {
+							candidates.push_back(*best);
+						}
+					}
+				}
+				std::sort(std::begin(candidates), std::end(candidates), [](const edge_collapse& a, const edge_collapse& b) { return a.mCost < b.mCost; });
+
+				// Select independent collapses, i.e. every vertex takes part in at most one collapse per pass:
+				std::vector<uint8_t> touched(mNumVertices, 0u);
+				std::vector<uint32_t> collapseTargets(mNumVertices, std::numeric_limits<uint32_t>::max());
+				size_t numCollapses = 0;
+				size_t removedTriangles = 0;
+				for (const auto& candidate : candidates) {
+					const auto toCanonical = mCanonical[candidate.mTo];
+					if (0u != touched[candidate.mFrom] || 0u != touched[toCanonical]) {
+						continue;
+					}
+					if (would_flip_triangles(candidate.mFrom, toCanonical, triangleOffsets, triangles)) {
+						continue;
+					}
+					collapseTargets[candidate.mFrom] = candidate.mTo;
+					touched[candidate.mFrom] = touched[toCanonical] = 1u;
+					mQuadrics[toCanonical] += mQuadrics[candidate.mFrom];
+					mMaxError = std::max(mMaxError, candidate.mError);
+					++numCollapses;
+					removedTriangles += candidate.mAlongBorder ? 1 : 2;
+					if (removedTriangles >= aTrianglesToRemove) {
+						break;
+					}
+				}
+				if (0 == numCollapses) {
+					return 0;
+				}
+
+				// Apply the collapses and remove the triangles which have become degenerate:
+				const auto remap = [&](uint32_t aIndex) {
+					const auto target = collapseTargets[mCanonical[aIndex]];
+					return std::numeric_limits<uint32_t>::max() == target ? aIndex : target;
+				};
+				std::vector<uint32_t> newIndices;
+				newIndices.reserve(mIndices.size());
+				for (size_t t = 0; t < mIndices.size(); t += 3) {
+					append_triangle_if_not_degenerate(newIndices, remap(mIndices[t]), remap(mIndices[t + 1]), remap(mIndices[t + 2]));
+				}
+				mIndices = std::move(newIndices);
+				return numCollapses;
+			}
+
+			size_t mNumVertices;
+			lod_generation_config mConfig;
+			float mExtent = 0.0f;
+			std::vector<glm::dvec3> mPositions;
+			std::vector<std::array<float, 5>> mAttributes;
+			std::vector<uint32_t> mCanonical;
+			std::vector<vertex_kind> mKinds;
+			std::vector<quadric> mQuadrics;
+			std::vector<uint32_t> mIndices;
+			double mMaxError = 0.0;
+		};
+	}
+
+	std::vector<mesh_lod> generate_lods(const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords, const std::vector<uint32_t>& aIndices, const lod_generation_config& aConfig)
+	{
+		if (aIndices.size() % 3 != 0) {
+			throw avk::runtime_error(fmt::format("The number of indices ({}) is not a multiple of three. Only triangle lists are supported.", aIndices.size()));
+		}
+		for (auto index : aIndices) {
+			if (index >= aPositions.size()) {
+				throw avk::runtime_error(fmt::format("Index {} is out of range for {} vertices.", index, aPositions.size()));
+			}
+		}
+		if ((!aNormals.empty() && aNormals.size() != aPositions.size()) || (!aTexCoords.empty() && aTexCoords.size() != aPositions.size())) {
+			throw avk::runtime_error(fmt::format("The numbers of normals ({}) and texture coordinates ({}) must either be zero or match the number of positions ({}).", aNormals.size(), aTexCoords.size(), aPositions.size()));
+		}
+
+		std::vector<mesh_lod> lods;
+		lods.push_back(mesh_lod{ aIndices, 0.0f, 0.0f });
+
+		simplifier s(aPositions, aNormals, aTexCoords, aIndices, aConfig);
+		if (s.extent() <= 0.0f) {
+			return lods;
+		}
+		const auto numTriangles = aIndices.size() / 3;
+		for (auto ratio : aConfig.mTargetRatios) {
+			s.simplify_to(3 * static_cast<size_t>(static_cast<double>(numTriangles) * static_cast<double>(ratio)));
+			if (s.indices().empty() || static_cast<float>(s.indices().size()) > static_cast<float>(lods.back().mIndices.size()) * aConfig.mMinReduction) {
+				break;
+			}
+			lods.push_back(mesh_lod{ s.indices(), s.relative_error(), s.relative_error() * s.extent() });
+		}
+		return lods;
+	}
+
+	std::vector<mesh_lod> generate_lods(const model_t& aModel, mesh_index_t aMeshIndex, const lod_generation_config& aConfig)
+	{
+		return generate_lods(
+			aModel.positions_for_mesh(aMeshIndex),
+			aModel.normals_for_mesh(aMeshIndex),
+			aModel.num_uv_components_for_mesh(aMeshIndex, 0) > 0 ? aModel.texture_coordinates_for_mesh<glm::vec2>(aMeshIndex, 0) : std::vector<glm::vec2>{},
+			aModel.indices_for_mesh<uint32_t>(aMeshIndex),
+			aConfig
+		);
+	}
+
+	std::vector<mesh_lod> generate_lods_cached(serializer& aSerializer, const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec3>& aNormals, const std::vector<glm::vec2>& aTexCoords, const std::vector<uint32_t>& aIndices, const lod_generation_config& aConfig)
+	{
+		std::vector<mesh_lod> lods;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			lods = generate_lods(aPositions, aNormals, aTexCoords, aIndices, aConfig);
+		}
+		aSerializer.archive(lods);
+		return lods;
+	}
+
+	std::vector<mesh_lod> generate_lods_cached(serializer& aSerializer, const model_t& aModel, mesh_index_t aMeshIndex, const lod_generation_config& aConfig)
+	{
+		std::vector<mesh_lod> lods;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			lods = generate_lods(aModel, aMeshIndex, aConfig);
+		}
+		aSerializer.archive(lods);
+		return lods;
+	}
+
+	size_t select_lod(const std::vector<mesh_lod>& aLods, float aMaxError)
+	{
+		for (size_t i = aLods.size(); i > 1; --i) {
+			if (aLods[i - 1].mError <= aMaxError) {
+				return i - 1;
+			}
+		}
+		return 0;
+	}
+
+	size_t select_lod(const std::vector<mesh_lod>& aLods, float aDistance, float aVerticalFov, float aViewportHeight, float aMaxPixelError)
+	{
+		// Size of one pixel in object space units at the given distance:
+		const auto pixelSize = 2.0f * aDistance * std::tan(0.5f * aVerticalFov) / aViewportHeight;
+		return select_lod(aLods, aMaxPixelError * pixelSize);
+	}
+}
@@ -50,5 +50,323 @@ namespace avk
 
 		return result;
 	}
+
+	namespace
+	{
+		// Spreads the lower 10 bits of the given value s.t. there are two zero bits between each of them
+		uint32_t spread_bits_by_3(uint32_t aValue)
+		{
+			aValue &= 0x000003FFu;
+			aValue = (aValue | (aValue << 16)) & 0x030000FFu;
+			aValue = (aValue | (aValue << 8)) & 0x0300F00Fu;
+			aValue = (aValue | (aValue << 4)) & 0x030C30C3u;
+			aValue = (aValue | (aValue << 2)) & 0x09249249u;
+			return aValue;
+		}
+
+		// 30-bit Morton code of a point within the given bounds
+		uint32_t morton_code(const glm::vec3& aPoint, const bounding_box& aBounds)
+		{
+			const auto extent = aBounds.extent();
+			const auto safeExtent = glm::vec3{ extent.x > 0.0f ? extent.x : 1.0f, extent.y > 0.0f ? extent.y : 1.0f, extent.z > 0.0f ? extent.z : 1.0f };
+			const auto q = glm::uvec3(glm::clamp((aPoint - aBounds.mMin) / safeExtent, glm::vec3{ 0.0f }, glm::vec3{ 1.0f }) * 1023.0f);
+			return (spread_bits_by_3(q.x) << 2) | (spread_bits_by_3(q.y) << 1) | spread_bits_by_3(q.z);
+		}
+
+		// Appends values with the given number of bits each to a bit stream of uint32_t values, least significant bits first
+		void append_bits(std::vector<uint32_t>& aStream, size_t aStreamBegin, size_t& aBitOffset, uint32_t aValue, uint32_t aNumBits)
+		{
+			const auto word = aStreamBegin + aBitOffset / 32;
+			const auto shift = static_cast<uint32_t>(aBitOffset % 32);
+			if (aStream.size() <= word) {
+				aStream.resize(word + 1, 0u);
+			}
+			aStream[word] |= aValue << shift;
+			if (shift + aNumBits > 32) {
+				aStream.push_back(aValue >> (32 - shift));
+			}
+			aBitOffset += aNumBits;
+		}
+	}
+
+	std::vector<meshlet> locality_meshlets_divider(const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		const model_t& aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices)
+	{
+		auto result = divide_triangles_into_meshlets(aVertices, aIndices, aMaxVertices, aMaxIndices);
+		for (auto& ml : result) {
+			ml.mMeshIndex = aMeshIndex;
+		}
+		return result;
+	}
+
+	std::vector<meshlet> divide_triangles_into_meshlets(const std::vector<glm::vec3>& aVertices, const std::vector<uint32_t>& aIndices, uint32_t aMaxVertices, uint32_t aMaxIndices)
+	{
+		if (aMaxVertices < 3 || aMaxVertices > 256) {
+			throw avk::runtime_error(fmt::format("Meshlets can have between 3 and 256 vertices, but {} have been requested.", aMaxVertices));
+		}
+		if (aMaxIndices < 3) {
+			throw avk::runtime_error(fmt::format("Meshlets require at least 3 indices, but {} have been requested.", aMaxIndices));
+		}
+
+		std::vector<meshlet> result;
+		const auto numTriangles = static_cast<uint32_t>(aIndices.size() / 3);
+		if (0 == numTriangles) {
+			return result;
+		}
+		const auto numVertices = static_cast<uint32_t>(aVertices.size());
+
+		// Vertex -> triangle adjacency in compressed form. The first mLiveCount[v] entries of vertex v's
+		// range contain the triangles which have not been assigned to a meshlet yet.
+		std::vector<uint32_t> adjacencyOffsets(numVertices + 1, 0u);
+		std::vector<uint32_t> liveCounts(numVertices, 0u);
+		for (auto index : aIndices) {
+			if (index >= numVertices) {
+				throw avk::runtime_error(fmt::format("Index {} is out of bounds of the {} vertices of the geometry to be divided into meshlets.", index, numVertices));
+			}
+			++liveCounts[index];
+		}
+		for (uint32_t v = 0; v < numVertices; ++v) {
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveCounts[v];
+			liveCounts[v] = 0u;
+		}
+		std::vector<uint32_t> adjacency(aIndices.size());
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			for (uint32_t c = 0; c < 3; ++c) {
+				const auto v = aIndices[3 * t + c];
+				if (c > 0 && v == aIndices[3 * t]) { continue; }
+				if (c > 1 && v == aIndices[3 * t + 1]) { continue; }
+				adjacency[adjacencyOffsets[v] + liveCounts[v]++] = t;
+			}
+		}
+
+		// Triangles in Morton order of their centroids. Whenever a meshlet can not grow along the
+		// surface anymore, the next unassigned triangle in this order is spatially close to it.
+		std::vector<glm::vec3> centroids(numTriangles);
+		bounding_box centroidBounds;
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			centroids[t] = (aVertices[aIndices[3 * t]] + aVertices[aIndices[3 * t + 1]] + aVertices[aIndices[3 * t + 2]]) / 3.0f;
+			centroidBounds.extend(centroids[t]);
+		}
+		std::vector<std::tuple<uint32_t, uint32_t>> mortonOrder(numTriangles);
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			mortonOrder[t] = std::make_tuple(morton_code(centroids[t], centroidBounds), t);
+		}
+		std::ranges::sort(mortonOrder);
+		size_t mortonCursor = 0;
+
+		std::vector<bool> assigned(numTriangles, false);
+		// Position of a vertex within the current meshlet, or -1 if it is not part of it
+		std::vector<int16_t> meshletSlot(numVertices, -1);
+
+		meshlet current;
+		glm::vec3 centroidSum{ 0.0f };
+
+		auto newVerticesOf = [&](uint32_t aTriangle) {
+			const auto a = aIndices[3 * aTriangle], b = aIndices[3 * aTriangle + 1], c = aIndices[3 * aTriangle + 2];
+			uint32_t count = meshletSlot[a] < 0 ? 1u : 0u;
+			count += (meshletSlot[b] < 0 && b != a) ? 1u : 0u;
+			count += (meshletSlot[c] < 0 && c != a && c != b) ? 1u : 0u;
+			return count;
+		};
+
+		auto finishMeshlet = [&]() {
+			for (auto v : current.mVertices) {
+				meshletSlot[v] = -1;
+			}
+			current.mVertexCount = static_cast<uint32_t>(current.mVertices.size());
+			current.mIndexCount = static_cast<uint32_t>(current.mIndices.size());
+			current.mVertices.shrink_to_fit();
+			current.mIndices.shrink_to_fit();
+			result.push_back(std::move(current));
+			current = meshlet{};
+			centroidSum = glm::vec3{ 0.0f };
+		};
+
+		std::optional<uint32_t> pendingSeed;
+		for (uint32_t numAssigned = 0; numAssigned < numTriangles; ++numAssigned) {
+			// Prefer triangles which add as few new vertices as possible, and then those closest to the meshlet's center:
+			std::optional<uint32_t> best = pendingSeed;
+			uint32_t bestNewVertices = 4u;
+			float bestDistance = std::numeric_limits<float>::max();
+			if (!best.has_value() && !current.mIndices.empty()) {
+				const auto center = centroidSum / static_cast<float>(current.mIndices.size() / 3);
+				for (auto v : current.mVertices) {
+					for (uint32_t i = adjacencyOffsets[v], end = adjacencyOffsets[v] + liveCounts[v]; i < end; ++i) {
+						const auto t = adjacency[i];
+						const auto newVertices = newVerticesOf(t);
+						const auto d = centroids[t] - center;
+						const auto distance = glm::dot(d, d);
+						if (newVertices < bestNewVertices || (newVertices == bestNewVertices && distance < bestDistance)) {
+							best = t;
+							bestNewVertices = newVertices;
+							bestDistance = distance;
+						}
+					}
+				}
+			}
+			if (!best.has_value()) {
+				while (assigned[std::get<1>(mortonOrder[mortonCursor])]) {
+					++mortonCursor;
+				}
+				best = std::get<1>(mortonOrder[mortonCursor]);
+			}
+			pendingSeed.reset();
+
+			const auto triangle = best.value();
+			if (current.mVertices.size() + newVerticesOf(triangle) > aMaxVertices || current.mIndices.size() + 3 > aMaxIndices) {
+				// The meshlet is full => the best candidate starts the next one, which keeps the meshlets spatially coherent
+				finishMeshlet();
+				pendingSeed = triangle;
+				--numAssigned;
+				continue;
+			}
+
+			for (uint32_t c = 0; c < 3; ++c) {
+				const auto v = aIndices[3 * triangle + c];
+				if (meshletSlot[v] < 0) {
+					meshletSlot[v] = static_cast<int16_t>(current.mVertices.size());
+					current.mVertices.push_back(v);
+				}
+				current.mIndices.push_back(static_cast<uint8_t>(meshletSlot[v]));
+			}
+			centroidSum += centroids[triangle];
+			assigned[triangle] = true;
+
+			// Remove the triangle from the live adjacency of its vertices:
+			for (uint32_t c = 0; c < 3; ++c) {
+				const auto v = aIndices[3 * triangle + c];
+				const auto begin = adjacency.begin() + adjacencyOffsets[v];
+				const auto end = begin + liveCounts[v];
+				const auto it = std::find(begin, end, triangle);
+				if (it != end) {
+					std::iter_swap(it, end - 1);
+					--liveCounts[v];
+				}
+			}
+		}
+		if (!current.mIndices.empty()) {
+			finishMeshlet();
+		}
+
+		return result;
+	}
+
+	meshlet_statistics analyze_meshlets(const std::vector<meshlet>& aMeshlets)
+	{
+		meshlet_statistics stats;
+		stats.mNumMeshlets = aMeshlets.size();
+
+		// Count distinct vertices per geometry, i.e. per model and (optional) mesh index:
+		std::map<std::tuple<const model_t*, std::optional<mesh_index_t>>, std::unordered_set<uint32_t>> uniqueVertices;
+		for (const auto& meshlet : aMeshlets) {
+			stats.mNumTriangles += meshlet.mIndexCount / 3u;
+			stats.mNumMeshletVertices += meshlet.mVertexCount;
+			stats.mMaxVerticesPerMeshlet = std::max(stats.mMaxVerticesPerMeshlet, meshlet.mVertexCount);
+			stats.mMaxTrianglesPerMeshlet = std::max(stats.mMaxTrianglesPerMeshlet, meshlet.mIndexCount / 3u);
+			const model_t* modelPtr = std::holds_alternative<std::monostate>(meshlet.mModel) ? nullptr : &meshlet.mModel.get();
+			auto& verticesOfGeometry = uniqueVertices[std::make_tuple(modelPtr, meshlet.mMeshIndex)];
+			verticesOfGeometry.insert(meshlet.mVertices.begin(), meshlet.mVertices.begin() + meshlet.mVertexCount);
+		}
+		for (const auto& [geometry, vertices] : uniqueVertices) {
+			stats.mNumUniqueVertices += vertices.size();
+		}
+
+		if (stats.mNumMeshlets > 0) {
+			stats.mAverageVerticesPerMeshlet = static_cast<float>(stats.mNumMeshletVertices) / static_cast<float>(stats.mNumMeshlets);
+			stats.mAverageTrianglesPerMeshlet = static_cast<float>(stats.mNumTriangles) / static_cast<float>(stats.mNumMeshlets);
+		}
+		if (stats.mNumTriangles > 0) {
+			stats.mVerticesPerTriangle = static_cast<float>(stats.mNumMeshletVertices) / static_cast<float>(stats.mNumTriangles);
+		}
+		if (stats.mNumUniqueVertices > 0) {
+			stats.mVertexDuplication = static_cast<float>(stats.mNumMeshletVertices) / static_cast<float>(stats.mNumUniqueVertices);
+		}
+		return stats;
+	}
+
+	meshlet_compact_gpu_data encode_compact_meshlet(const meshlet& aMeshlet, std::vector<uint32_t>& aMeshletData)
+	{
+		if (aMeshlet.mVertexCount > 255 || aMeshlet.mIndexCount / 3 > 255) {
+			throw avk::runtime_error(fmt::format("A meshlet with {} vertices and {} triangles can not be represented by meshlet_compact_gpu_data.", aMeshlet.mVertexCount, aMeshlet.mIndexCount / 3));
+		}
+
+		meshlet_compact_gpu_data result{};
+		result.mDataOffset = static_cast<uint32_t>(aMeshletData.size());
+		result.mVertexCount = static_cast<uint8_t>(aMeshlet.mVertexCount);
+		result.mPrimitiveCount = static_cast<uint8_t>(aMeshlet.mIndexCount / 3);
+
+		uint32_t maxVertex = 0u;
+		result.mVertexBase = aMeshlet.mVertexCount > 0 ? std::numeric_limits<uint32_t>::max() : 0u;
+		for (uint32_t i = 0; i < aMeshlet.mVertexCount; ++i) {
+			result.mVertexBase = std::min(result.mVertexBase, aMeshlet.mVertices[i]);
+			maxVertex = std::max(maxVertex, aMeshlet.mVertices[i]);
+		}
+		const auto maxDelta = maxVertex - result.mVertexBase;
+		result.mVertexDeltaBits = static_cast<uint8_t>(std::max(1, static_cast<int>(std::bit_width(maxDelta))));
+		result.mIndexBits = static_cast<uint8_t>(std::max(1, static_cast<int>(std::bit_width(std::max(aMeshlet.mVertexCount, 1u) - 1u))));
+
+		// Region 1: vertex index differences
+		size_t bitOffset = 0;
+		const auto verticesBegin = aMeshletData.size();
+		for (uint32_t i = 0; i < aMeshlet.mVertexCount; ++i) {
+			append_bits(aMeshletData, verticesBegin, bitOffset, aMeshlet.mVertices[i] - result.mVertexBase, result.mVertexDeltaBits);
+		}
+
+		// Region 2: triangles as a bit stream
+		bitOffset = 0;
+		const auto trianglesBegin = aMeshletData.size();
+		for (uint32_t i = 0; i < result.mPrimitiveCount * 3u; ++i) {
+			append_bits(aMeshletData, trianglesBegin, bitOffset, aMeshlet.mIndices[i], result.mIndexBits);
+		}
+
+		return result;
+	}
+
+	std::vector<bounding_volume_gpu_data> convert_bounding_volumes_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
+	{
+		std::vector<bounding_volume_gpu_data> result;
+		result.reserve(aMeshlets.size());
+		for (const auto& meshlet : aMeshlets) {
+			result.push_back(to_gpu_data(meshlet.mBoundingBox, meshlet.mBoundingSphere));
+		}
+		return result;
+	}
+
+	std::vector<bounding_volume_gpu_data> convert_bounding_volumes_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets)
+	{
+		std::vector<bounding_volume_gpu_data> result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = convert_bounding_volumes_for_gpu_usage(aMeshlets);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+
+	std::vector<meshlet_culling_gpu_data> convert_culling_data_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
+	{
+		std::vector<meshlet_culling_gpu_data> result;
+		result.reserve(aMeshlets.size());
+		for (const auto& meshlet : aMeshlets) {
+			result.push_back(meshlet_culling_gpu_data{
+				glm::vec4{ meshlet.mBoundingSphere.mCenter, meshlet.mBoundingSphere.mRadius },
+				glm::vec4{ meshlet.mNormalCone.mApex, 0.0f },
+				glm::vec4{ meshlet.mNormalCone.mAxis, meshlet.mNormalCone.mCutoff }
+			});
+		}
+		return result;
+	}
+
+	std::vector<meshlet_culling_gpu_data> convert_culling_data_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets)
+	{
+		std::vector<meshlet_culling_gpu_data> result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = convert_culling_data_for_gpu_usage(aMeshlets);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
 }
 
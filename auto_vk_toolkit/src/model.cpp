@@ -1,23 +1,123 @@
 
 #include <sstream>
+#include <random>
+#include <thread>
+#include <assimp/Exporter.hpp>
+#include <assimp/ProgressHandler.hpp>
+#include <assimp/DefaultIOSystem.h>
 
 #include "model.hpp"
+#include "serializer.hpp"
+#include "thread_pool.hpp"
 
 namespace avk
 {
+	namespace
+	{
+		/** Identifies one file which a baked model has been imported from, by its size and modification time */
+		struct baked_model_source
+		{
+			std::string mPath;
+			uint64_t mSize = 0;
+			int64_t mModificationTime = 0;
+
+			bool operator==(const baked_model_source&) const = default;
+		};
+
+		template<class Archive>
+		void serialize(Archive& aArchive, baked_model_source& aValue)
+		{
+			aArchive(aValue.mPath, aValue.mSize, aValue.mModificationTime);
+		}
+
+		/** Gets the current size and modification time of the given file, or nothing if it can not be queried. */
+		std::optional<baked_model_source> stamp_baked_model_source(const std::string& aPath)
+		{
+			std::error_code ec;
+			const auto size = std::filesystem::file_size(aPath, ec);
+			if (ec) {
+				return {};
+			}
+			const auto time = std::filesystem::last_write_time(aPath, ec);
+			if (ec) {
+				return {};
+			}
+			return baked_model_source{ aPath, static_cast<uint64_t>(size), static_cast<int64_t>(time.time_since_epoch().count()) };
+		}
+
+		/** Assimp IO system which records the paths of all the files that an importer opens */
+		class recording_io_system : public Assimp::DefaultIOSystem
+		{
+		public:
+			explicit recording_io_system(std::vector<std::string>& aOpenedFiles) : mOpenedFiles{ aOpenedFiles } {}
+			Assimp::IOStream* Open(const char* aFile, const char* aMode = "rb") override
+			{
+				auto* stream = Assimp::DefaultIOSystem::Open(aFile, aMode);
+				if (nullptr != stream && std::find(std::begin(mOpenedFiles), std::end(mOpenedFiles), aFile) == std::end(mOpenedFiles)) {
+					mOpenedFiles.emplace_back(aFile);
+				}
+				return stream;
+			}
+		private:
+			std::vector<std::string>& mOpenedFiles;
+		};
+
+		constexpr const char* sBakedModelMagic = "AVKBAKE";
+		// Increase whenever the layout of baked files changes:
+		constexpr uint32_t sBakedModelFormatVersion = 2u;
+		// Assimp's binary scene representation (importer and exporter):
+		constexpr const char* sBakedSceneFormat = "assbin";
+
+		/** Forwards Assimp's progress updates to a load_progress_callback */
+		class forwarding_progress_handler : public Assimp::ProgressHandler
+		{
+		public:
+			explicit forwarding_progress_handler(load_progress_callback aCallback) : mCallback{ std::move(aCallback) } {}
+			bool Update(float aPercentage) override
+			{
+				if (aPercentage >= 0.0f) {
+					mCallback(std::min(aPercentage, 1.0f));
+				}
+				return true; // => never abort
+			}
+		private:
+			load_progress_callback mCallback;
+		};
+	}
+
 
-	avk::owning_resource<model_t> model_t::load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags)
+	avk::owning_resource<model_t> model_t::load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags, load_progress_callback aProgressCallback)
 	{
 		model_t result;
 		result.mModelPath = avk::clean_up_path(aPath);
 		result.mImporter = std::make_unique<Assimp::Importer>();
+		if (aProgressCallback) {
+			// The importer takes ownership of the handler:
+			result.mImporter->SetProgressHandler(new forwarding_progress_handler(aProgressCallback));
+		}
 		result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags);
+		if (aProgressCallback) {
+			// Don't keep the callback (and whatever it has captured) alive for the lifetime of the model:
+			result.mImporter->SetProgressHandler(nullptr);
+		}
 		if (nullptr == result.mScene) {
 			throw avk::runtime_error(fmt::format("Loading model from '{}' failed.", aPath));
 		}
 		result.initialize_materials();
+		result.initialize_node_hierarchy();
+		result.initialize_bounding_volumes();
+		if (aProgressCallback) {
+			aProgressCallback(1.0f);
+		}
 		return result;
 	}
+
+	std::future<avk::owning_resource<model_t>> model_t::load_from_file_async(const std::string& aPath, aiProcessFlagsType aAssimpFlags, load_progress_callback aProgressCallback)
+	{
+		return thread_pool::shared().submit([aPath, aAssimpFlags, aProgressCallback = std::move(aProgressCallback)]() {
+			return load_from_file(aPath, aAssimpFlags, aProgressCallback);
+		});
+	}
 	
 	avk::owning_resource<model_t> model_t::load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags)
 	{
@@ -29,9 +129,142 @@ namespace avk
 			throw avk::runtime_error("Loading model from memory failed.");
 		}
 		result.initialize_materials();
+		result.initialize_node_hierarchy();
+		result.initialize_bounding_volumes();
+		return result;
+	}
+
+	avk::owning_resource<model_t> model_t::load_from_file_baked(const std::string& aPath, aiProcessFlagsType aAssimpFlags, std::optional<std::string> aBakedPath)
+	{
+		const auto bakedPath = aBakedPath.value_or(aPath + ".avkbake");
+
+		if (does_cache_file_exist(bakedPath)) {
+			try {
+				serializer baked(bakedPath, serializer::mode::deserialize);
+				std::string magic;
+				uint32_t formatVersion = 0;
+				aiProcessFlagsType assimpFlags = 0;
+				std::vector<baked_model_source> sources;
+				baked.archive(magic);
+				baked.archive(formatVersion);
+				baked.archive(assimpFlags);
+				baked.archive(sources);
+				const bool upToDate = sBakedModelMagic == magic && sBakedModelFormatVersion == formatVersion
+					&& aAssimpFlags == assimpFlags && !sources.empty()
+					&& std::all_of(std::begin(sources), std::end(sources), [](const baked_model_source& source) {
+						return stamp_baked_model_source(source.mPath) == source;
+					});
+				if (upToDate) {
+					uint64_t sceneDataSize = 0;
+					baked.archive(sceneDataSize);
+					std::vector<std::byte> sceneData(static_cast<size_t>(sceneDataSize));
+					baked.archive_memory(sceneData.data(), sceneData.size());
+
+					model_t result;
+					result.mModelPath = avk::clean_up_path(aPath);
+					result.mImporter = std::make_unique<Assimp::Importer>();
+					// The baked scene has already been post-processed => don't apply any flags again:
+					result.mScene = result.mImporter->ReadFileFromMemory(sceneData.data(), sceneData.size(), 0u, sBakedSceneFormat);
+					if (nullptr != result.mScene) {
+						result.initialize_materials();
+						result.initialize_node_hierarchy();
+						result.initialize_bounding_volumes();
+						return result;
+					}
+					LOG_WARNING(fmt::format("Reading baked model '{}' failed: {} Will import '{}' again.", bakedPath, result.mImporter->GetErrorString(), aPath));
+				}
+				else {
+					LOG_DEBUG(fmt::format("Baked model '{}' is out of date. Will import '{}' again.", bakedPath, aPath));
+				}
+			}
+			catch (const std::exception& e) {
+				LOG_WARNING(fmt::format("Reading baked model '{}' failed: {} Will import '{}' again.", bakedPath, e.what(), aPath));
+			}
+		}
+
+		// Import from source and record every file which the importer opens (e.g., .gltf + .bin, or .obj + .mtl):
+		model_t result;
+		result.mModelPath = avk::clean_up_path(aPath);
+		result.mImporter = std::make_unique<Assimp::Importer>();
+		std::vector<std::string> sourceFiles;
+		// The importer takes ownership of the IO system:
+		result.mImporter->SetIOHandler(new recording_io_system(sourceFiles));
+		result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags);
+		// Don't keep recording into sourceFiles, which goes out of scope:
+		result.mImporter->SetIOHandler(nullptr);
+		if (nullptr == result.mScene) {
+			throw avk::runtime_error(fmt::format("Loading model from '{}' failed.", aPath));
+		}
+		result.initialize_materials();
+		result.initialize_node_hierarchy();
+		result.initialize_bounding_volumes();
+
+		if (!result.write_baked(bakedPath, sourceFiles, aAssimpFlags)) {
+			LOG_WARNING(fmt::format("Unable to write baked model '{}'. Subsequent loads of '{}' will import it again.", bakedPath, aPath));
+		}
 		return result;
 	}
 
+	bool model_t::write_baked(const std::string& aBakedPath, const std::vector<std::string>& aSourceFiles, aiProcessFlagsType aAssimpFlags) const
+	{
+		std::vector<baked_model_source> sources;
+		for (const auto& path : aSourceFiles) {
+			auto source = stamp_baked_model_source(path);
+			if (!source.has_value()) {
+				return false;
+			}
+			sources.push_back(std::move(source.value()));
+		}
+		if (sources.empty()) {
+			return false;
+		}
+
+		Assimp::Exporter exporter;
+		const aiExportDataBlob* blob = exporter.ExportToBlob(mScene, sBakedSceneFormat);
+		if (nullptr == blob) {
+			return false;
+		}
+
+		// Write to a temporary file first and replace the baked file only once it is complete, so that
+		// neither a failed write nor a concurrent reader can ever see a partially written baked file.
+		// Every writer gets its own temporary file (in the same directory, s.t. the rename is atomic),
+		// s.t. concurrent writers of the same baked file, be it in other threads or processes, do not interfere:
+		static std::atomic<uint64_t> sTmpFileCounter{ 0 };
+		std::string tmpPath;
+		try {
+			tmpPath = fmt::format("{}.{:x}-{:x}-{}.tmp", aBakedPath,
+				std::random_device{}(),
+				std::hash<std::thread::id>{}(std::this_thread::get_id()),
+				sTmpFileCounter.fetch_add(1));
+			serializer baked(tmpPath, serializer::mode::serialize);
+			std::string magic = sBakedModelMagic;
+			uint32_t formatVersion = sBakedModelFormatVersion;
+			aiProcessFlagsType assimpFlags = aAssimpFlags;
+			uint64_t sceneDataSize = static_cast<uint64_t>(blob->size);
+			baked.archive(magic);
+			baked.archive(formatVersion);
+			baked.archive(assimpFlags);
+			baked.archive(sources);
+			baked.archive(sceneDataSize);
+			baked.archive_memory(blob->data, blob->size);
+		}
+		catch (const std::exception&) {
+			if (!tmpPath.empty()) {
+				std::error_code ec;
+				std::filesystem::remove(tmpPath, ec);
+			}
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tmpPath, aBakedPath, ec);
+		if (ec) {
+			std::filesystem::remove(tmpPath, ec);
+			return false;
+		}
+		return true;
+	}
+
 	
 	void model_t::initialize_materials()
 	{
@@ -42,54 +275,124 @@ namespace avk
 		}
 	}
 
-	aiNode* model_t::find_mesh_root_node(unsigned int aMeshIndexToFind) const
-	{
-		return mesh_node_traverser(aMeshIndexToFind, mScene->mRootNode);
-	}
-	
-	aiNode* model_t::mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const
+	void model_t::initialize_node_hierarchy()
 	{
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return aNode;
+		mNodes.clear();
+		mNodeIndexForName.clear();
+		mNodeIndexForMesh.assign(static_cast<size_t>(mScene->mNumMeshes), std::optional<size_t>{});
+		mNodeIndexForLight.assign(static_cast<size_t>(mScene->mNumLights), std::optional<size_t>{});
+		mNodeIndexForCamera.assign(static_cast<size_t>(mScene->mNumCameras), std::optional<size_t>{});
+
+		// Lights and cameras are associated with the FIRST node (in hierarchy order) which has the same name:
+		std::unordered_map<std::string, size_t> firstNodeIndexForName;
+
+		// Iterative depth-first traversal in pre-order => parents are always added before their children.
+		// Each stack entry consists of: the node, its parent's index, and its parent's accumulated transformation.
+		std::stack<std::tuple<aiNode*, std::optional<size_t>, aiMatrix4x4>> toVisit;
+		toVisit.emplace(mScene->mRootNode, std::optional<size_t>{}, aiMatrix4x4{});
+		while (!toVisit.empty()) {
+			auto [node, parentIndex, parentM] = toVisit.top();
+			toVisit.pop();
+
+			const aiMatrix4x4 nodeM = parentM * node->mTransformation;
+			const size_t nodeIndex = mNodes.size();
+			mNodes.push_back(model_node{ node, parentIndex, to_mat4(nodeM) });
+
+			auto name = to_string(node->mName);
+			firstNodeIndexForName.try_emplace(name, nodeIndex);
+			mNodeIndexForName[std::move(name)] = nodeIndex;
+
+			for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+				auto& entry = mNodeIndexForMesh[node->mMeshes[i]];
+				if (!entry.has_value()) {
+					entry = nodeIndex;
+				}
+			}
+
+			// Push in reverse order so that the children are visited in their natural order:
+			for (unsigned int i = node->mNumChildren; i > 0; --i) {
+				toVisit.emplace(node->mChildren[i - 1], nodeIndex, nodeM);
 			}
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto* node = mesh_node_traverser(aMeshIndexToFind, aNode->mChildren[i]);
-			if (nullptr != node) {
-				return node;
+
+		for (unsigned int i = 0; i < mScene->mNumLights; ++i) {
+			auto it = firstNodeIndexForName.find(to_string(mScene->mLights[i]->mName));
+			if (std::end(firstNodeIndexForName) != it) {
+				mNodeIndexForLight[i] = it->second;
+			}
+		}
+		for (unsigned int i = 0; i < mScene->mNumCameras; ++i) {
+			auto it = firstNodeIndexForName.find(to_string(mScene->mCameras[i]->mName));
+			if (std::end(firstNodeIndexForName) != it) {
+				mNodeIndexForCamera[i] = it->second;
 			}
 		}
-		return nullptr;
 	}
-	
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const
+
+	void model_t::initialize_bounding_volumes()
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return to_mat4(nodeM);
+		const auto numMeshes = static_cast<size_t>(mScene->mNumMeshes);
+		mMeshBoundingBoxes.assign(numMeshes, bounding_box{});
+		mMeshBoundingSpheres.assign(numMeshes, bounding_sphere{});
+		thread_pool::shared().parallel_for(numMeshes, [this](size_t i) {
+			const auto positions = positions_for_mesh(static_cast<mesh_index_t>(i));
+			mMeshBoundingBoxes[i] = compute_bounding_box(positions);
+			mMeshBoundingSpheres[i] = compute_bounding_sphere(positions);
+		});
+
+		// Children are stored after their parents => traverse backwards to accumulate the bounds bottom-up:
+		for (auto& node : mNodes) {
+			node.mBoundingBox = bounding_box{};
+			node.mBoundingSphere = bounding_sphere{};
+		}
+		for (size_t i = mNodes.size(); i > 0; --i) {
+			auto& node = mNodes[i - 1];
+			for (unsigned int m = 0; m < node.mNode->mNumMeshes; ++m) {
+				const auto meshIndex = node.mNode->mMeshes[m];
+				node.mBoundingBox.extend(transformed(mMeshBoundingBoxes[meshIndex], node.mGlobalTransform));
+				node.mBoundingSphere = merge(node.mBoundingSphere, transformed(mMeshBoundingSpheres[meshIndex], node.mGlobalTransform));
+			}
+			// Merging spheres can overestimate a lot => use the box's sphere if that is tighter:
+			const auto boxSphere = bounding_sphere_for(node.mBoundingBox);
+			if (!boxSphere.empty() && boxSphere.mRadius < node.mBoundingSphere.mRadius) {
+				node.mBoundingSphere = boxSphere;
+			}
+			if (node.mParentIndex.has_value()) {
+				auto& parent = mNodes[node.mParentIndex.value()];
+				parent.mBoundingBox.extend(node.mBoundingBox);
+				parent.mBoundingSphere = merge(parent.mBoundingSphere, node.mBoundingSphere);
 			}
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser(aMeshIndexToFind, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
-			}
+	}
+
+	std::optional<size_t> model_t::node_index_for_name(const std::string& aNodeName) const
+	{
+		auto it = mNodeIndexForName.find(aNodeName);
+		if (std::end(mNodeIndexForName) == it) {
+			return {};
 		}
-		return {};
+		return it->second;
+	}
+
+	std::optional<size_t> model_t::node_index_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		assert(mNodeIndexForMesh.size() > aMeshIndex);
+		return mNodeIndexForMesh[aMeshIndex];
+	}
+
+	aiNode* model_t::find_mesh_root_node(unsigned int aMeshIndexToFind) const
+	{
+		const auto nodeIndex = node_index_for_mesh(static_cast<mesh_index_t>(aMeshIndexToFind));
+		if (!nodeIndex.has_value()) {
+			return nullptr;
+		}
+		return mNodes[nodeIndex.value()].mNode;
 	}
 
 	glm::mat4 model_t::transformation_matrix_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		// Find the mesh in Assim's node hierarchy
-		return transformation_matrix_traverser(static_cast<unsigned int>(aMeshIndex), mScene->mRootNode, aiMatrix4x4{}).value();
+		// Look up the mesh's node in the flattened node hierarchy
+		return mNodes[node_index_for_mesh(aMeshIndex).value()].mGlobalTransform;
 	}
 
 	glm::mat4 model_t::mesh_root_matrix(mesh_index_t aMeshIndex) const
@@ -662,101 +965,137 @@ namespace avk
 		return result;
 	}
 
-	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	bool model_t::write_bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, std::span<glm::vec4> aWeightsDestination, std::span<glm::uvec4> aIndicesDestination, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset, bool aLogWarnings) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec4> result;
-		result.reserve(n);
+		const auto n = static_cast<size_t>(paiMesh->mNumVertices);
+		const bool writeWeights = !aWeightsDestination.empty();
+		const bool writeIndices = !aIndicesDestination.empty();
+		if (!writeWeights && !writeIndices) {
+			return false;
+		}
+		if ((writeWeights && aWeightsDestination.size() < n) || (writeIndices && aIndicesDestination.size() < n)) {
+			throw avk::runtime_error(fmt::format("The destination for the bone weights or bone indices of the mesh at index {} is too small; it must have space for {} elements.", aMeshIndex, n));
+		}
+
 		if (!paiMesh->HasBones()) {
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights for each vertex.", aMeshIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(1.f, 0.f, 0.f, 0.f);
+			if (aLogWarnings) {
+				LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights and ({},{},{},{}) bone indices for each vertex.", aMeshIndex, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset));
+			}
+			if (writeWeights) {
+				std::fill_n(aWeightsDestination.begin(), n, glm::vec4{ 1.f, 0.f, 0.f, 0.f });
 			}
+			if (writeIndices) {
+				std::fill_n(aIndicesDestination.begin(), n, glm::uvec4{ aBoneIndexOffset });
+			}
+			return false;
 		}
-		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone* pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
+
+		// Every vertex' four most influential <bone index, weight> pairs are kept in descending order of weight.
+		// They are gathered directly in the destination memory, i.e. without any per-vertex allocations.
+		// (Only if no weights have been requested, they are gathered in a temporary array instead.)
+		// Unused slots hold a sentinel below any weight, so that influences with a weight of zero still take
+		// a slot and have their bone index written (like the previous sort-based implementation did).
+		// The sum of ALL weights per vertex is only tracked if normalization is requested.
+		const bool normalize = aNormalizeBoneWeights && writeWeights;
+		std::vector<float> weightSums;
+		if (normalize) {
+			weightSums.resize(n, 0.0f);
+		}
+		std::vector<glm::vec4> localWeights;
+		auto weights = aWeightsDestination;
+		auto indices = aIndicesDestination;
+		if (!writeWeights) { // Weights are required for selecting the top four
+			localWeights.resize(n);
+			weights = localWeights;
+		}
+		constexpr float unusedSlot = std::numeric_limits<float>::lowest();
+		std::fill_n(weights.begin(), n, glm::vec4{ unusedSlot });
+		if (writeIndices) {
+			std::fill_n(indices.begin(), n, glm::uvec4{ aBoneIndexOffset });
+		}
+
+		for (unsigned int j = 0; j < paiMesh->mNumBones; ++j) {
+			const aiBone* pBone = paiMesh->mBones[j];
+			for (unsigned int b = 0; b < pBone->mNumWeights; ++b) {
+				const auto vi = static_cast<size_t>(pBone->mWeights[b].mVertexId);
+				const auto w = pBone->mWeights[b].mWeight;
+				assert(vi < n);
+				if (normalize) {
+					weightSums[vi] += w;
+				}
+
+				// Insert into the vertex' top four:
+				auto& vw = weights[vi];
+				int pos = 0;
+				while (pos < 4 && !(w > vw[pos])) {
+					++pos;
+				}
+				if (pos == 4) {
+					continue;
+				}
+				for (int k = 3; k > pos; --k) {
+					vw[k] = vw[k - 1];
+				}
+				vw[pos] = w;
+				if (writeIndices) {
+					auto& vb = indices[vi];
+					for (int k = 3; k > pos; --k) {
+						vb[k] = vb[k - 1];
+					}
+					vb[pos] = j + aBoneIndexOffset;
 				}
 			}
-			
-			// We've got bone weights. Proceed as planned.
-			bool hasNonNormalizedBoneWeights = false;
-			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
+		}
 
-				auto& weights = result.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					weights[j] = std::get<float>(vTempWeightsPerVertex[i][j]);
+		for (size_t i = 0; i < n; ++i) {
+			for (int k = 0; k < 4; ++k) {
+				if (unusedSlot == weights[i][k]) {
+					weights[i][k] = 0.f;
 				}
+			}
+		}
 
-				// "normalize" the weights, if requested, so they add up to one
-				if (aNormalizeBoneWeights) {
-					// Blender can save meshes with a total weight sum > 1. So first scale down by the total sum (we need to consider all weights, not only the first four!)
-					float sum = 0.0f;
-					for (auto& w : vTempWeightsPerVertex[i]) {
-						sum += std::get<float>(w);
-					}
-					if (sum > 0.0f) {
-						weights /= sum;
-					}
-					hasNonNormalizedBoneWeights = sum > 1.001f || hasNonNormalizedBoneWeights;
-					// if we have more than 4 weights, assign all the unconsidered ones to the 4th bone
-					weights.w = 1.0f - weights.x - weights.y - weights.z;
+		// "normalize" the weights, if requested, so they add up to one
+		bool hasNonNormalizedBoneWeights = false;
+		if (normalize) {
+			for (size_t i = 0; i < n; ++i) {
+				// Blender can save meshes with a total weight sum > 1. So first scale down by the total sum (we need to consider all weights, not only the first four!)
+				const auto sum = weightSums[i];
+				if (sum > 0.0f) {
+					weights[i] /= sum;
 				}
+				hasNonNormalizedBoneWeights = sum > 1.001f || hasNonNormalizedBoneWeights;
+				// if we have more than 4 weights, assign all the unconsidered ones to the 4th bone
+				weights[i].w = 1.0f - weights[i].x - weights[i].y - weights[i].z;
 			}
-			if (hasNonNormalizedBoneWeights) {
+			if (hasNonNormalizedBoneWeights && aLogWarnings) {
 				LOG_WARNING(fmt::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", aMeshIndex));
 			}
 		}
+		return hasNonNormalizedBoneWeights;
+	}
+
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> model_t::bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset) const
+	{
+		const auto n = number_of_vertices_for_mesh(aMeshIndex);
+		std::vector<glm::vec4> weights(n);
+		std::vector<glm::uvec4> indices(n);
+		write_bone_weights_and_indices_for_mesh(aMeshIndex, weights, indices, aNormalizeBoneWeights, aBoneIndexOffset);
+		return std::make_tuple(std::move(weights), std::move(indices));
+	}
+
+	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	{
+		std::vector<glm::vec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		write_bone_weights_and_indices_for_mesh(aMeshIndex, result, {}, aNormalizeBoneWeights);
 		return result;
 	}
 
 	std::vector<glm::uvec4> model_t::bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
-		std::vector<glm::uvec4> result;
-		result.reserve(n);
-		if (!paiMesh->HasBones()) {
-			const uint32_t fallbackIndex = aBoneIndexOffset;
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return ({},{},{},{}) bone indices for each vertex.", aMeshIndex, fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex);
-			}
-		}
-		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone * pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
-				}
-			}
-			
-			// We've got bone weights. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
-
-				auto& indices = result.emplace_back(aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					indices[j] = std::get<uint32_t>(vTempWeightsPerVertex[i][j]) + aBoneIndexOffset;
-				}
-			}
-		}
+		std::vector<glm::uvec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		write_bone_weights_and_indices_for_mesh(aMeshIndex, {}, result, false, aBoneIndexOffset);
 		return result;
 	}
 
@@ -815,23 +1154,6 @@ namespace avk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* aNode, const aiMatrix4x4& aM) const
-	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aLight->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_light(aLight, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
-			}
-		}
-		return {};
-	}
-
 	std::vector<glm::vec3> model_t::positions_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
@@ -902,6 +1224,159 @@ namespace avk
 		return result;
 	}
 
+	size_t model_t::number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		size_t result = 0;
+		for (auto meshIndex : aMeshIndices) {
+			result += number_of_vertices_for_mesh(meshIndex);
+		}
+		return result;
+	}
+
+	void model_t::log_missing_vertex_attributes(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<vertex_attribute_layout>& aLayout) const
+	{
+		for (auto meshIndex : aMeshIndices) {
+			assert(meshIndex < mScene->mNumMeshes);
+			const aiMesh* paiMesh = mScene->mMeshes[meshIndex];
+			for (const auto& attrib : aLayout) {
+				switch (attrib.mAttribute) {
+				case vertex_attribute::normal:
+					if (nullptr == paiMesh->mNormals) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain normals. Will write (0,0,1) normals for each vertex.", meshIndex));
+					}
+					break;
+				case vertex_attribute::tangent:
+					if (nullptr == paiMesh->mTangents) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents. Will write (1,0,0) tangents for each vertex.", meshIndex));
+					}
+					break;
+				case vertex_attribute::bitangent:
+					if (nullptr == paiMesh->mBitangents) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain bitangents. Will write (0,1,0) bitangents for each vertex.", meshIndex));
+					}
+					break;
+				case vertex_attribute::color:
+					assert(attrib.mSet >= 0 && attrib.mSet < AI_MAX_NUMBER_OF_COLOR_SETS);
+					if (nullptr == paiMesh->mColors[attrib.mSet]) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain a color set at index {}. Will write opaque magenta for each vertex.", meshIndex, attrib.mSet));
+					}
+					break;
+				case vertex_attribute::texture_coordinates_2d:
+				case vertex_attribute::texture_coordinates_3d:
+					assert(attrib.mSet >= 0 && attrib.mSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+					if (nullptr == paiMesh->mTextureCoords[attrib.mSet]) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain a texture coordinates at index {}. Will write zeros for each vertex.", meshIndex, attrib.mSet));
+					}
+					break;
+				default:
+					break;
+				}
+			}
+		}
+	}
+
+	size_t model_t::write_vertex_data(const std::vector<mesh_index_t>& aMeshIndices, const std::vector<vertex_attribute_layout>& aLayout, std::span<std::byte> aDestination, size_t aFirstVertex, bool aLogMissingAttributes) const
+	{
+		const auto totalVertexCount = number_of_vertices_for_meshes(aMeshIndices);
+		if (0 == totalVertexCount) {
+			return 0;
+		}
+		if (aLogMissingAttributes) {
+			log_missing_vertex_attributes(aMeshIndices, aLayout);
+		}
+
+		// Make sure that everything fits BEFORE writing anything:
+		for (const auto& attrib : aLayout) {
+			const auto lastByte = attrib.mOffset + (aFirstVertex + totalVertexCount - 1) * attrib.mStride + size_of(attrib.mAttribute);
+			if (lastByte > aDestination.size()) {
+				throw avk::runtime_error(fmt::format("The destination memory of {} bytes is too small for writing {} vertices starting at vertex {}; {} bytes are required.", aDestination.size(), totalVertexCount, aFirstVertex, lastByte));
+			}
+		}
+
+		// Writes n values, which are read via a getter from the source, into the destination with the given stride:
+		auto writeStrided = [](std::byte* bDst, size_t bStride, unsigned int bCount, auto bGetValue) {
+			for (unsigned int i = 0; i < bCount; ++i) {
+				const auto value = bGetValue(i);
+				std::memcpy(bDst + static_cast<size_t>(i) * bStride, &value, sizeof(value));
+			}
+		};
+
+		size_t vertexOffset = aFirstVertex;
+		for (auto meshIndex : aMeshIndices) {
+			assert(meshIndex < mScene->mNumMeshes);
+			const aiMesh* paiMesh = mScene->mMeshes[meshIndex];
+			const auto n = paiMesh->mNumVertices;
+
+			for (const auto& attrib : aLayout) {
+				std::byte* dst = aDestination.data() + attrib.mOffset + vertexOffset * attrib.mStride;
+				switch (attrib.mAttribute) {
+				case vertex_attribute::position:
+					writeStrided(dst, attrib.mStride, n, [paiMesh](unsigned int i) { return to_vec3(paiMesh->mVertices[i]); });
+					break;
+				case vertex_attribute::normal:
+					if (nullptr == paiMesh->mNormals) {
+						writeStrided(dst, attrib.mStride, n, [](unsigned int) { return glm::vec3{ 0.f, 0.f, 1.f }; });
+					}
+					else {
+						writeStrided(dst, attrib.mStride, n, [paiMesh](unsigned int i) { return to_vec3(paiMesh->mNormals[i]); });
+					}
+					break;
+				case vertex_attribute::tangent:
+					if (nullptr == paiMesh->mTangents) {
+						writeStrided(dst, attrib.mStride, n, [](unsigned int) { return glm::vec3{ 1.f, 0.f, 0.f }; });
+					}
+					else {
+						writeStrided(dst, attrib.mStride, n, [paiMesh](unsigned int i) { return to_vec3(paiMesh->mTangents[i]); });
+					}
+					break;
+				case vertex_attribute::bitangent:
+					if (nullptr == paiMesh->mBitangents) {
+						writeStrided(dst, attrib.mStride, n, [](unsigned int) { return glm::vec3{ 0.f, 1.f, 0.f }; });
+					}
+					else {
+						writeStrided(dst, attrib.mStride, n, [paiMesh](unsigned int i) { return to_vec3(paiMesh->mBitangents[i]); });
+					}
+					break;
+				case vertex_attribute::color:
+					assert(attrib.mSet >= 0 && attrib.mSet < AI_MAX_NUMBER_OF_COLOR_SETS);
+					if (nullptr == paiMesh->mColors[attrib.mSet]) {
+						writeStrided(dst, attrib.mStride, n, [](unsigned int) { return glm::vec4{ 1.f, 0.f, 1.f, 1.f }; });
+					}
+					else {
+						const aiColor4D* colors = paiMesh->mColors[attrib.mSet];
+						writeStrided(dst, attrib.mStride, n, [colors](unsigned int i) { return glm::vec4{ colors[i].r, colors[i].g, colors[i].b, colors[i].a }; });
+					}
+					break;
+				case vertex_attribute::texture_coordinates_2d:
+				case vertex_attribute::texture_coordinates_3d:
+					{
+						assert(attrib.mSet >= 0 && attrib.mSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+						const aiVector3D* uvs = paiMesh->mTextureCoords[attrib.mSet];
+						// Components beyond the set's number of uv components are written as zeros:
+						const auto nuv = num_uv_components_for_mesh(meshIndex, attrib.mSet);
+						if (nullptr != uvs && (nuv < 1 || nuv > 3)) {
+							throw avk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, meshIndex, attrib.mSet));
+						}
+						const glm::vec3 mask{ 1.f, nuv > 1 ? 1.f : 0.f, nuv > 2 ? 1.f : 0.f };
+						if (vertex_attribute::texture_coordinates_2d == attrib.mAttribute) {
+							writeStrided(dst, attrib.mStride, n, [uvs, mask](unsigned int i) { return nullptr == uvs ? glm::vec2{ 0.f } : glm::vec2{ to_vec3(uvs[i]) * mask }; });
+						}
+						else {
+							writeStrided(dst, attrib.mStride, n, [uvs, mask](unsigned int i) { return nullptr == uvs ? glm::vec3{ 0.f } : to_vec3(uvs[i]) * mask; });
+						}
+					}
+					break;
+				default:
+					throw avk::logic_error(fmt::format("Unsupported vertex attribute {}.", static_cast<int>(attrib.mAttribute)));
+				}
+			}
+
+			vertexOffset += n;
+		}
+
+		return totalVertexCount;
+	}
+
 	std::vector<lightsource> model_t::lights() const
 	{
 		std::vector<lightsource> result;
@@ -909,7 +1384,7 @@ namespace avk
 		result.reserve(n);
 		for (decltype(n) i = 0; i < n; ++i) {
 			const aiLight* aiLight = mScene->mLights[i];
-			glm::mat4 transfo = transformation_matrix_traverser_for_light(aiLight, mScene->mRootNode, aiMatrix4x4()).value();
+			glm::mat4 transfo = mNodes[mNodeIndexForLight[i].value()].mGlobalTransform;
 			glm::mat3 transfoForDirections = glm::mat3(glm::inverse(glm::transpose(transfo))); // TODO: inverse transpose okay for direction??
 			lightsource light;
 			light.mAngleInnerCone = aiLight->mAngleInnerCone;
@@ -971,11 +1446,11 @@ namespace avk
 			aiMatrix4x4 projMat;
 			aiCam->GetCameraMatrix(projMat);
 			cam.set_projection_matrix(glm::make_mat4(&projMat.a1));
-			auto trafo = transformation_matrix_traverser_for_camera(aiCam, mScene->mRootNode, aiMatrix4x4());
-			if (trafo.has_value()) {
+			if (mNodeIndexForCamera[i].has_value()) {
+				const auto& trafo = mNodes[mNodeIndexForCamera[i].value()].mGlobalTransform;
 				glm::vec3 side = glm::normalize(glm::cross(lookdir, updir));
-				cam.set_translation(trafo.value() * glm::vec4(cam.translation(), 1));
-				glm::mat3 dirtrafo = glm::mat3(glm::inverse(glm::transpose(trafo.value())));
+				cam.set_translation(trafo * glm::vec4(cam.translation(), 1));
+				glm::mat3 dirtrafo = glm::mat3(glm::inverse(glm::transpose(trafo)));
 				cam.set_rotation(glm::quatLookAt(dirtrafo * lookdir, dirtrafo * updir));
 			}
 			result.push_back(cam);
@@ -1017,9 +1492,11 @@ namespace avk
 		result.mAnimationIndex = aAnimationIndex;
 
 		// --------------------------- helper collections ------------------------------------
-		// Contains mappings of bone/node names to aiNode* pointers:
-		std::unordered_map<std::string, aiNode*> mapNameToNode;
-		add_all_to_node_map(mapNameToNode, mScene->mRootNode);
+		// Looks up bone/node names in the precomputed node hierarchy, returns nullptr if there is no such node:
+		auto findNodeByName = [this](const aiString& bName) -> aiNode* {
+			const auto nodeIndex = node_index_for_name(to_string(bName));
+			return nodeIndex.has_value() ? mNodes[nodeIndex.value()].mNode : nullptr;
+		};
 
 		// Which node is modified by bone animation? => Only those with an entry in this map:
 		std::unordered_map<aiNode*, aiNodeAnim*> mapNodeToBoneAnimation;
@@ -1167,7 +1644,7 @@ namespace avk
 			anode.mLocalTransform = to_mat4(bNode->mTransformation);
 
 			// See if we have an inverse bind pose matrix for this node:
-			assert(nullptr == bChannel || mapNameToNode.find(to_string(bChannel->mNodeName))->second == bNode);
+			assert(nullptr == bChannel || findNodeByName(bChannel->mNodeName) == bNode);
 			for (size_t i = 0; i < mapsBoneToMatrixInfo.size(); ++i) {
 				auto it = mapsBoneToMatrixInfo[i].find(bNode);
 				if (std::end(mapsBoneToMatrixInfo[i]) != it) {
@@ -1200,15 +1677,15 @@ namespace avk
 		for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
 			auto* channel = ani->mChannels[i];
 
-			auto it = mapNameToNode.find(to_string(channel->mNodeName));
-			if (it == std::end(mapNameToNode)) {
+			auto* channelNode = findNodeByName(channel->mNodeName);
+			if (nullptr == channelNode) {
 				LOG_ERROR(fmt::format("Node name '{}', referenced from channel[{}], could not be found in the nodeMap.", to_string(channel->mNodeName), i));
 				continue;
 			}
 
 			//if (channel->mNumPositionKeys + channel->mNumRotationKeys + channel->mNumScalingKeys > 0) {
 			//requiredForAnimation.insert(it->second);
-			mapNodeToBoneAnimation[it->second] = channel;
+			mapNodeToBoneAnimation[channelNode] = channel;
 			//// Also mark all its parent nodes as required for animation (but not modified by bones!):
 			//auto* parent = it->second->mParent;
 			//while (nullptr != parent) {
@@ -1245,14 +1722,14 @@ namespace avk
 				if (bi < mScene->mMeshes[mi]->mNumBones) {
 					auto* bone = mScene->mMeshes[mi]->mBones[bi];
 
-					auto it = mapNameToNode.find(to_string(bone->mName));
-					if (it == std::end(mapNameToNode)) {
+					auto* boneNode = findNodeByName(bone->mName);
+					if (nullptr == boneNode) {
 						LOG_ERROR(fmt::format("Bone named '{}' could not be found in the nodeMap.", to_string(bone->mName)));
 						continue;
 					}
 
-					assert(!bmi.contains(it->second));
-					bmi[it->second] = bone_mesh_data{
+					assert(!bmi.contains(boneNode));
+					bmi[boneNode] = bone_mesh_data{
 						to_mat4(bone->mOffsetMatrix),
 						inverseMeshRootMatrix,
 						mesh_bone_info{i, mi, bi, boneIndexOffsetsPerMesh[mi]}
@@ -1272,12 +1749,14 @@ namespace avk
 		// AND NOW: Construct the animated_nodes "tree"
 #ifdef _DEBUG
 		{
+			// Collect the nodes of all channels which could be found (channels whose node cannot be found are reported below).
+			// This check only emits a warning, i.e. it does not reject any input:
 			std::vector<aiNode*> sanityCheck;
 			for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
 				auto* channel = ani->mChannels[i];
-				auto it = mapNameToNode.find(to_string(channel->mNodeName));
-				if (it == std::end(mapNameToNode)) {
-					sanityCheck.push_back(it->second);
+				auto* channelNode = findNodeByName(channel->mNodeName);
+				if (nullptr != channelNode) {
+					sanityCheck.push_back(channelNode);
 				}
 			}
 			std::sort(std::begin(sanityCheck), std::end(sanityCheck));
@@ -1295,13 +1774,12 @@ namespace avk
 		for (unsigned int i = 0; i < ani->mNumChannels; ++i) {
 			auto* channel = ani->mChannels[i];
 
-			auto it = mapNameToNode.find(to_string(channel->mNodeName));
-			if (it == std::end(mapNameToNode)) {
+			auto* node = findNodeByName(channel->mNodeName);
+			if (nullptr == node) {
 				LOG_ERROR(fmt::format("Node name '{}', referenced from channel[{}], could not be found in the nodeMap.", to_string(channel->mNodeName), i));
 				continue;
 			}
 
-			auto* node = it->second;
 			std::stack<aiNode*> boneAnimatedParents;
 			auto* parent = node->mParent;
 			while (nullptr != parent) {
@@ -1342,12 +1820,12 @@ namespace avk
 
 				if (bi < mScene->mMeshes[mi]->mNumBones) {
 					auto* bone = mScene->mMeshes[mi]->mBones[bi];
-					auto it = mapNameToNode.find(to_string(bone->mName));
-					assert(std::end(mapNameToNode) != it);
+					auto* boneNode = findNodeByName(bone->mName);
+					assert(nullptr != boneNode);
 
 					addAnimatedNode(
 						nullptr, // <-- This is fine. This node is just not affected by animation but still needs to receive bone matrix updates
-						it->second, getAnimatedParentIndex(it->second), getUnanimatedParentTransform(it->second)
+						boneNode, getAnimatedParentIndex(boneNode), getUnanimatedParentTransform(boneNode)
 					);
 				}
 				else {
@@ -1364,28 +1842,15 @@ namespace avk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const
+	animation model_t::prepare_animation(const animation_clip_data& aClip, const std::vector<mesh_index_t>& aMeshIndices)
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aCamera->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_camera(aCamera, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
-			}
-		}
-		return {};
+		auto result = prepare_animation(aClip.mAnimationIndex, aMeshIndices);
+		result.classify_nodes(aClip);
+		return result;
 	}
 
-	void model_t::add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode)
+	packed_animation model_t::prepare_packed_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices)
 	{
-		aNodeMap[to_string(aNode->mName)] = aNode;
-		for (unsigned int i = 0; i < aNode->mNumChildren; ++i) {
-			add_all_to_node_map(aNodeMap, aNode->mChildren[i]);
-		}
+		return packed_animation(prepare_animation(aAnimationIndex, aMeshIndices));
 	}
 }
@@ -1,5 +1,6 @@
 
 #include "orca_scene.hpp"
+#include "thread_pool.hpp"
 
 namespace avk
 {
@@ -17,7 +18,7 @@ namespace avk
 		return result;
 	}
 
-	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags)
+	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, load_progress_callback aProgressCallback)
 	{
 		std::ifstream stream(aPath, std::ifstream::in);
 		if (!stream.good() || !stream || stream.fail())
@@ -154,12 +155,41 @@ namespace avk
 		auto fsceneBasePath = avk::extract_base_path(result.mLoadPath);
 		for (auto& modelData : result.mModelData) {
 			modelData.mFullPathName = avk::combine_paths(fsceneBasePath, modelData.mFileName);
-			modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags);
 		}
+
+		// The overall progress is the average over all models' progress values:
+		const auto numModels = result.mModelData.size();
+		std::vector<float> modelProgress(numModels, 0.0f);
+		std::mutex progressMutex;
+		auto reportProgress = [&](size_t aModelIndex, float aProgress) {
+			std::scoped_lock lock(progressMutex);
+			modelProgress[aModelIndex] = aProgress;
+			float sum = 0.0f;
+			for (auto p : modelProgress) {
+				sum += p;
+			}
+			aProgressCallback(sum / static_cast<float>(numModels));
+		};
+
+		thread_pool::shared().parallel_for(numModels, [&](size_t i) {
+			load_progress_callback modelProgressCallback;
+			if (aProgressCallback) {
+				modelProgressCallback = [&reportProgress, i](float aProgress) { reportProgress(i, aProgress); };
+			}
+			auto& modelData = result.mModelData[i];
+			modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags, std::move(modelProgressCallback));
+		});
 		
 		return result;
 	}
 
+	std::future<avk::owning_resource<orca_scene_t>> orca_scene_t::load_from_file_async(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, load_progress_callback aProgressCallback)
+	{
+		return thread_pool::shared().submit([aPath, aAssimpFlags, aProgressCallback = std::move(aProgressCallback)]() {
+			return load_from_file(aPath, aAssimpFlags, aProgressCallback);
+		});
+	}
+
 	glm::vec3 convert_json_to_vec3(nlohmann::json& j)
 	{
 		std::vector<float> v = j;
@@ -0,0 +1,756 @@
+#include <numeric>
+
+#include "packed_animation.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		/** Coefficients of the polynomial approximation of the slerp weights, see packed_animation::evaluate */
+		constexpr size_t sSlerpCoefficientCount = 8;
+		constexpr float sSlerpMu = 1.90110745351730037f;
+		constexpr float sSlerpU[sSlerpCoefficientCount] = {
+			1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f), 1.0f / (3.0f * 7.0f), 1.0f / (4.0f * 9.0f),
+			1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f), sSlerpMu / (8.0f * 17.0f)
+		};
+		constexpr float sSlerpV[sSlerpCoefficientCount] = {
+			1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+			5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, sSlerpMu * 8.0f / 17.0f
+		};
+
+		/** Same as animation::find_positions_in_keys, but for pooled float key times */
+		std::tuple<uint32_t, uint32_t> find_positions_in_key_times(const float* aTimes, uint32_t aCount, float aTime, uint32_t& aCursor)
+		{
+			constexpr uint32_t maxLinearKeySteps = 4;
+			const uint32_t maxIndex = aCount - 1;
+
+			uint32_t pos1 = std::min(aCursor, maxIndex);
+			if (aTimes[pos1] <= aTime) {
+				for (uint32_t step = 0; step < maxLinearKeySteps && pos1 < maxIndex && aTimes[pos1 + 1] <= aTime; ++step) {
+					++pos1;
+				}
+				if (pos1 < maxIndex && aTimes[pos1 + 1] <= aTime) {
+					pos1 = static_cast<uint32_t>(std::upper_bound(aTimes + pos1 + 1, aTimes + aCount, aTime) - aTimes) - 1;
+				}
+			}
+			else {
+				const auto* it = std::upper_bound(aTimes, aTimes + pos1, aTime);
+				pos1 = it == aTimes ? 0 : static_cast<uint32_t>(it - aTimes) - 1;
+			}
+
+			aCursor = pos1;
+			return std::make_tuple(pos1, pos1 + (pos1 < maxIndex ? 1 : 0));
+		}
+
+		/** Same as animation::get_interpolation_factor, but for float key times */
+		float interpolation_factor(float aTime1, float aTime2, float aTime)
+		{
+			const float timeDifferenceTicks = aTime2 - aTime1;
+			if (std::abs(timeDifferenceTicks) < 2.3e-16f) {
+				return 1.0f;
+			}
+			return (aTime - aTime1) / timeDifferenceTicks;
+		}
+
+		/** Looks up the two keys which surround aTime in the given channel and returns them along with the interpolation factor.
+		 *	If the channel has no keys, aIdentity is returned for both.
+		 *	@param	aValueAt	Invocable which returns the key value at the given index of the pooled key arrays
+		 */
+		template <typename V, typename F>
+		float lookup_keys(const std::vector<float>& aTimes, uint32_t aOffset, uint32_t aCount, float aTime, uint32_t& aCursor, const V& aIdentity, F&& aValueAt, V& aValue1, V& aValue2)
+		{
+			if (0 == aCount) {
+				aValue1 = aValue2 = aIdentity;
+				return 0.0f;
+			}
+			auto [pos1, pos2] = find_positions_in_key_times(aTimes.data() + aOffset, aCount, aTime, aCursor);
+			aValue1 = aValueAt(aOffset + pos1);
+			aValue2 = aValueAt(aOffset + pos2);
+			return interpolation_factor(aTimes[aOffset + pos1], aTimes[aOffset + pos2], aTime);
+		}
+
+		/** Quantizes each component of aValue to 16 bits within the range [aMin, aMin + 65535 * aStep] */
+		std::array<uint16_t, 3> quantize_vector(const glm::vec3& aValue, const glm::vec3& aMin, const glm::vec3& aStep)
+		{
+			std::array<uint16_t, 3> result{};
+			for (int c = 0; c < 3; ++c) {
+				const float steps = aStep[c] > 0.0f ? std::round((aValue[c] - aMin[c]) / aStep[c]) : 0.0f;
+				result[c] = static_cast<uint16_t>(std::clamp(steps, 0.0f, 65535.0f));
+			}
+			return result;
+		}
+
+		glm::vec3 dequantize_vector(const std::array<uint16_t, 3>& aValue, const glm::vec3& aMin, const glm::vec3& aStep)
+		{
+			return aMin + glm::vec3{ aValue[0], aValue[1], aValue[2] } * aStep;
+		}
+
+		/** Largest value of the three smaller components of a unit quaternion, i.e. 1 / sqrt(2) */
+		constexpr float sSmallestThreeRange = 0.707106781186547524f;
+		constexpr float sSmallestThreeMaxValue = 32767.0f;
+
+		/** Encodes a unit quaternion in 48 bits: The largest component is omitted (and made positive by negating the quaternion
+		 *	if necessary, which represents the same rotation), the other three are stored with 15 bits each. The index of the
+		 *	omitted component is stored in the most significant bits of the first two values. */
+		std::array<uint16_t, 3> encode_smallest_three(const glm::quat& aValue)
+		{
+			const float components[4] = { aValue.x, aValue.y, aValue.z, aValue.w };
+			int largest = 0;
+			for (int c = 1; c < 4; ++c) {
+				if (std::abs(components[c]) > std::abs(components[largest])) {
+					largest = c;
+				}
+			}
+			const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+			std::array<uint16_t, 3> result{};
+			for (int c = 0, r = 0; c < 4; ++c) {
+				if (c == largest) {
+					continue;
+				}
+				const float normalized = (components[c] * sign / sSmallestThreeRange + 1.0f) * 0.5f;
+				result[r++] = static_cast<uint16_t>(std::round(std::clamp(normalized, 0.0f, 1.0f) * sSmallestThreeMaxValue));
+			}
+			result[0] |= static_cast<uint16_t>((largest >> 1) << 15);
+			result[1] |= static_cast<uint16_t>((largest & 1) << 15);
+			return result;
+		}
+
+		glm::quat decode_smallest_three(const std::array<uint16_t, 3>& aValue)
+		{
+			const int largest = ((aValue[0] >> 15) << 1) | (aValue[1] >> 15);
+			float components[4];
+			float sumOfSquares = 0.0f;
+			for (int c = 0, r = 0; c < 4; ++c) {
+				if (c == largest) {
+					continue;
+				}
+				const float normalized = static_cast<float>(aValue[r++] & 0x7FFF) / sSmallestThreeMaxValue;
+				components[c] = (normalized * 2.0f - 1.0f) * sSmallestThreeRange;
+				sumOfSquares += components[c] * components[c];
+			}
+			components[largest] = std::sqrt(std::max(1.0f - sumOfSquares, 0.0f));
+			return glm::quat{ components[3], components[0], components[1], components[2] };
+		}
+
+		void validate_poses(const animation_pose& aPose1, const animation_pose& aPose2, std::span<const float> aMask)
+		{
+			const auto n = aPose1.mTranslations.size();
+			if (aPose2.mTranslations.size() != n || aPose1.mRotations.size() != n || aPose2.mRotations.size() != n || aPose1.mScales.size() != n || aPose2.mScales.size() != n) {
+				throw avk::runtime_error("The poses do not have the same number of nodes.");
+			}
+			if (!aMask.empty() && aMask.size() != n) {
+				throw avk::runtime_error("The mask does not have one weight per node of the poses.");
+			}
+		}
+
+		/** Normalized lerp along the shorter arc, which is sufficient for blending poses and much cheaper than slerp */
+		glm::quat nlerp(const glm::quat& aFrom, const glm::quat& aTo, float aWeight)
+		{
+			const float sign = glm::dot(aFrom, aTo) < 0.0f ? -1.0f : 1.0f;
+			return glm::normalize(aFrom * (1.0f - aWeight) + aTo * (aWeight * sign));
+		}
+	}
+
+	packed_animation::packed_animation(const animation& aAnimation, animation_key_format aKeyFormat)
+		: mKeyFormat{ aKeyFormat }
+		, mAnimationIndex{ aAnimation.mAnimationIndex }
+		, mClassifiedTickRange{ aAnimation.mClassifiedTickRange }
+	{
+		const auto& nodes = aAnimation.mAnimationData;
+		const auto n = nodes.size();
+
+		// Establish parent-before-child order by sorting by depth. prepare_animation already yields parents before their
+		// children, but sorting by depth keeps siblings together, which improves the locality of the parent lookups.
+		std::vector<uint32_t> depths(n, 0);
+		for (size_t i = 0; i < n; ++i) {
+			if (nodes[i].mAnimatedParentIndex.has_value()) {
+				const auto parent = nodes[i].mAnimatedParentIndex.value();
+				if (parent >= i) {
+					throw avk::runtime_error("Animated nodes must be given in parent-before-child order.");
+				}
+				depths[i] = depths[parent] + 1;
+			}
+		}
+		mAnimatedNodeIndices.resize(n);
+		std::iota(mAnimatedNodeIndices.begin(), mAnimatedNodeIndices.end(), 0u);
+		std::stable_sort(mAnimatedNodeIndices.begin(), mAnimatedNodeIndices.end(), [&depths](uint32_t a, uint32_t b) { return depths[a] < depths[b]; });
+		std::vector<uint32_t> packedIndexOf(n);
+		for (uint32_t pi = 0; pi < static_cast<uint32_t>(n); ++pi) {
+			packedIndexOf[mAnimatedNodeIndices[pi]] = pi;
+		}
+
+		const bool quantize = animation_key_format::quantized == mKeyFormat;
+		// Computes the range of a key collection's values, s.t. they can be quantized to 16 bits per component:
+		const auto quantizationRangeOf = [](const auto& aKeys) {
+			quantization_range result;
+			if (!aKeys.empty()) {
+				glm::vec3 maxValue = aKeys.front().mValue;
+				result.mMin = maxValue;
+				for (const auto& key : aKeys) {
+					result.mMin = glm::min(result.mMin, key.mValue);
+					maxValue = glm::max(maxValue, key.mValue);
+				}
+				result.mStep = (maxValue - result.mMin) / 65535.0f;
+			}
+			return result;
+		};
+
+		mParentIndices.reserve(n);
+		mParentTransforms.reserve(n);
+		mTranslationRanges.reserve(n);
+		mRotationRanges.reserve(n);
+		mScalingRanges.reserve(n);
+		for (uint32_t pi = 0; pi < static_cast<uint32_t>(n); ++pi) {
+			const auto& anode = nodes[mAnimatedNodeIndices[pi]];
+			mParentIndices.push_back(anode.mAnimatedParentIndex.has_value() ? packedIndexOf[anode.mAnimatedParentIndex.value()] : sNoParent);
+
+			// Nodes which are constant during the clip which they have been classified for (see animation::classify_nodes)
+			// are treated like nodes without keys:
+			const bool constant = node_animation_class::constant == anode.mAnimationClass;
+			const bool hasKeys = !constant && anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() > 0;
+			if (quantize) {
+				mTranslationQuantizationRanges.push_back(hasKeys ? quantizationRangeOf(anode.mPositionKeys) : quantization_range{});
+				mScalingQuantizationRanges.push_back(hasKeys ? quantizationRangeOf(anode.mScalingKeys) : quantization_range{});
+			}
+			if (!hasKeys) {
+				// The local transform of a node without keys is constant => fold it into the parent transform, and leave the channels empty:
+				mParentTransforms.push_back(anode.mParentTransform * (constant ? anode.mStaticLocalTransform : anode.mLocalTransform));
+				mTranslationRanges.push_back({});
+				mRotationRanges.push_back({});
+				mScalingRanges.push_back({});
+				continue;
+			}
+			mParentTransforms.push_back(anode.mParentTransform);
+
+			mTranslationRanges.push_back({ static_cast<uint32_t>(mTranslationTimes.size()), static_cast<uint32_t>(anode.mPositionKeys.size()) });
+			for (const auto& key : anode.mPositionKeys) {
+				mTranslationTimes.push_back(static_cast<float>(key.mTime));
+				if (quantize) {
+					mQuantizedTranslationValues.push_back(quantize_vector(key.mValue, mTranslationQuantizationRanges.back().mMin, mTranslationQuantizationRanges.back().mStep));
+				}
+				else {
+					mTranslationValues.push_back(key.mValue);
+				}
+			}
+			mRotationRanges.push_back({ static_cast<uint32_t>(mRotationTimes.size()), static_cast<uint32_t>(anode.mRotationKeys.size()) });
+			for (const auto& key : anode.mRotationKeys) {
+				mRotationTimes.push_back(static_cast<float>(key.mTime));
+				if (quantize) {
+					mQuantizedRotationValues.push_back(encode_smallest_three(glm::normalize(key.mValue)));
+				}
+				else {
+					mRotationValues.push_back(key.mValue);
+				}
+			}
+			mScalingRanges.push_back({ static_cast<uint32_t>(mScalingTimes.size()), static_cast<uint32_t>(anode.mScalingKeys.size()) });
+			for (const auto& key : anode.mScalingKeys) {
+				mScalingTimes.push_back(static_cast<float>(key.mTime));
+				if (quantize) {
+					mQuantizedScalingValues.push_back(quantize_vector(key.mValue, mScalingQuantizationRanges.back().mMin, mScalingQuantizationRanges.back().mStep));
+				}
+				else {
+					mScalingValues.push_back(key.mValue);
+				}
+			}
+		}
+
+		for (uint32_t pi = 0; pi < static_cast<uint32_t>(n); ++pi) {
+			for (const auto& target : nodes[mAnimatedNodeIndices[pi]].mBoneMeshTargets) {
+				mBoneNodeIndices.push_back(pi);
+				mBoneTargetIndices.push_back(target.mMeshBoneInfo.mGlobalBoneIndexOffset + target.mMeshBoneInfo.mMeshLocalBoneIndex);
+				mBoneInverseMeshRootMatrices.push_back(target.mInverseMeshRootMatrix);
+				mBoneInverseBindPoseMatrices.push_back(target.mInverseBindPoseMatrix);
+			}
+		}
+
+		mState = create_state();
+	}
+
+	packed_animation_state packed_animation::create_state() const
+	{
+		const auto n = number_of_nodes();
+		packed_animation_state result;
+		result.mTranslationCursors.resize(n, 0);
+		result.mRotationCursors.resize(n, 0);
+		result.mScalingCursors.resize(n, 0);
+		result.mGlobalTransforms.resize(n, glm::mat4{ 1.0f });
+		result.mLocalPose = create_pose();
+		return result;
+	}
+
+	animation_pose packed_animation::create_pose() const
+	{
+		const auto n = number_of_nodes();
+		animation_pose result;
+		result.mTranslations.resize(n, glm::vec3{ 0.0f });
+		result.mRotations.resize(n, glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f });
+		result.mScales.resize(n, glm::vec3{ 1.0f });
+		return result;
+	}
+
+	bool packed_animation::has_same_layout(const packed_animation& aOther) const
+	{
+		if (mParentIndices != aOther.mParentIndices || mBoneTargetIndices != aOther.mBoneTargetIndices || mBoneNodeIndices != aOther.mBoneNodeIndices) {
+			return false;
+		}
+		// Constant nodes are only constant within the clip which they have been classified for:
+		if (mClassifiedTickRange != aOther.mClassifiedTickRange) {
+			return false;
+		}
+		// The parent transforms contain the local transforms of the nodes without keys, which have been folded into them
+		// (e.g. after animation::reduce_keys has removed the keys of constant nodes), and those must match as well:
+		if (mParentTransforms != aOther.mParentTransforms) {
+			return false;
+		}
+		// The local transforms of nodes without keys are part of their parent transforms, i.e. they must not have keys in either or in both:
+		const auto hasKeys = [](const packed_animation& aAnimation, size_t aNode) { return aAnimation.mTranslationRanges[aNode].mCount + aAnimation.mRotationRanges[aNode].mCount + aAnimation.mScalingRanges[aNode].mCount > 0; };
+		for (size_t i = 0; i < mParentIndices.size(); ++i) {
+			if (hasKeys(*this, i) != hasKeys(aOther, i)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::vector<float> packed_animation::create_subtree_mask(size_t aPackedNodeIndex, float aWeight) const
+	{
+		const auto n = number_of_nodes();
+		if (aPackedNodeIndex >= n) {
+			throw avk::runtime_error("The node index for the subtree mask is out of bounds.");
+		}
+		std::vector<float> result(n, 0.0f);
+		result[aPackedNodeIndex] = aWeight;
+		// Parents come before their children => a single pass propagates the weight down the whole subtree:
+		for (size_t i = aPackedNodeIndex + 1; i < n; ++i) {
+			if (sNoParent != mParentIndices[i]) {
+				result[i] = result[mParentIndices[i]];
+			}
+		}
+		return result;
+	}
+
+	size_t packed_animation::key_data_size_in_bytes() const
+	{
+		const auto bytesOf = [](const auto& aVector) { return aVector.size() * sizeof(aVector[0]); };
+		return bytesOf(mTranslationTimes) + bytesOf(mRotationTimes) + bytesOf(mScalingTimes)
+			+ bytesOf(mTranslationValues) + bytesOf(mRotationValues) + bytesOf(mScalingValues)
+			+ bytesOf(mQuantizedTranslationValues) + bytesOf(mQuantizedRotationValues) + bytesOf(mQuantizedScalingValues)
+			+ bytesOf(mTranslationQuantizationRanges) + bytesOf(mScalingQuantizationRanges)
+			+ bytesOf(mTranslationRanges) + bytesOf(mRotationRanges) + bytesOf(mScalingRanges);
+	}
+
+	void packed_animation::validate_clip(const animation_clip_data& aClip) const
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (aClip.mAnimationIndex != mAnimationIndex) {
+			throw avk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+		}
+		if (mClassifiedTickRange.has_value() && mClassifiedTickRange.value() != std::make_tuple(aClip.mStartTicks, aClip.mEndTicks)) {
+			throw avk::runtime_error("The nodes of this animation have been classified for a different clip. Create the packed_animation from an animation which has been classified for the passed clip, or whose classification has been reset.");
+		}
+	}
+
+	glm::vec3 packed_animation::translation_key_value(uint32_t aNode, uint32_t aKey) const
+	{
+		if (animation_key_format::quantized == mKeyFormat) {
+			return dequantize_vector(mQuantizedTranslationValues[aKey], mTranslationQuantizationRanges[aNode].mMin, mTranslationQuantizationRanges[aNode].mStep);
+		}
+		return mTranslationValues[aKey];
+	}
+
+	glm::quat packed_animation::rotation_key_value(uint32_t aNode, uint32_t aKey) const
+	{
+		if (animation_key_format::quantized == mKeyFormat) {
+			return decode_smallest_three(mQuantizedRotationValues[aKey]);
+		}
+		return mRotationValues[aKey];
+	}
+
+	glm::vec3 packed_animation::scaling_key_value(uint32_t aNode, uint32_t aKey) const
+	{
+		if (animation_key_format::quantized == mKeyFormat) {
+			return dequantize_vector(mQuantizedScalingValues[aKey], mScalingQuantizationRanges[aNode].mMin, mScalingQuantizationRanges[aNode].mStep);
+		}
+		return mScalingValues[aKey];
+	}
+
+	template <size_t L>
+	void packed_animation::sample_local_pose(double aTimeInTicks, animation_pose& aPose, packed_animation_state& aState) const
+	{
+		static_assert(L == 4 || L == 8, "packed_animation can only be evaluated with 4 or 8 lanes.");
+
+		const auto n = static_cast<uint32_t>(number_of_nodes());
+		if (aState.mGlobalTransforms.size() != n) {
+			throw avk::logic_error("The evaluation state has not been created for this packed_animation.");
+		}
+		if (aPose.mTranslations.size() != n || aPose.mRotations.size() != n || aPose.mScales.size() != n) {
+			throw avk::logic_error("The pose has not been created for this packed_animation.");
+		}
+		if (mClassifiedTickRange.has_value()) {
+			// Constant nodes are only constant within the classified clip (with some tolerance for the conversion from seconds to ticks):
+			const auto [startTicks, endTicks] = mClassifiedTickRange.value();
+			const auto tolerance = 1e-6 * std::max({ 1.0, std::abs(startTicks), std::abs(endTicks) });
+			if (aTimeInTicks < startTicks - tolerance || aTimeInTicks > endTicks + tolerance) {
+				throw avk::runtime_error("The animation time is outside of the clip which the nodes of this animation have been classified for.");
+			}
+		}
+		const auto time = static_cast<float>(aTimeInTicks);
+
+		for (uint32_t batchBegin = 0; batchBegin < n; batchBegin += static_cast<uint32_t>(L)) {
+			// Keys of this batch's nodes, one lane per node:
+			alignas(32) float t1[3][L], t2[3][L], tf[L];
+			alignas(32) float r1[4][L], r2[4][L], rf[L];
+			alignas(32) float s1[3][L], s2[3][L], sf[L];
+
+			// Gather (scalar, because the key lookups differ per node). Lanes past the last node replicate the last node.
+			for (size_t l = 0; l < L; ++l) {
+				const auto i = std::min(batchBegin + static_cast<uint32_t>(l), n - 1);
+
+				glm::vec3 vec1, vec2;
+				glm::quat quat1, quat2;
+				if (animation_key_format::quantized == mKeyFormat) {
+					const auto& translationRange = mTranslationQuantizationRanges[i];
+					tf[l] = lookup_keys(mTranslationTimes, mTranslationRanges[i].mOffset, mTranslationRanges[i].mCount, time, aState.mTranslationCursors[i], glm::vec3{ 0.0f },
+						[&](uint32_t aKey) { return dequantize_vector(mQuantizedTranslationValues[aKey], translationRange.mMin, translationRange.mStep); }, vec1, vec2);
+					for (int c = 0; c < 3; ++c) { t1[c][l] = vec1[c]; t2[c][l] = vec2[c]; }
+					rf[l] = lookup_keys(mRotationTimes, mRotationRanges[i].mOffset, mRotationRanges[i].mCount, time, aState.mRotationCursors[i], glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f },
+						[&](uint32_t aKey) { return decode_smallest_three(mQuantizedRotationValues[aKey]); }, quat1, quat2);
+					const auto& scalingRange = mScalingQuantizationRanges[i];
+					sf[l] = lookup_keys(mScalingTimes, mScalingRanges[i].mOffset, mScalingRanges[i].mCount, time, aState.mScalingCursors[i], glm::vec3{ 1.0f },
+						[&](uint32_t aKey) { return dequantize_vector(mQuantizedScalingValues[aKey], scalingRange.mMin, scalingRange.mStep); }, vec1, vec2);
+				}
+				else {
+					tf[l] = lookup_keys(mTranslationTimes, mTranslationRanges[i].mOffset, mTranslationRanges[i].mCount, time, aState.mTranslationCursors[i], glm::vec3{ 0.0f },
+						[&](uint32_t aKey) { return mTranslationValues[aKey]; }, vec1, vec2);
+					for (int c = 0; c < 3; ++c) { t1[c][l] = vec1[c]; t2[c][l] = vec2[c]; }
+					rf[l] = lookup_keys(mRotationTimes, mRotationRanges[i].mOffset, mRotationRanges[i].mCount, time, aState.mRotationCursors[i], glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f },
+						[&](uint32_t aKey) { return mRotationValues[aKey]; }, quat1, quat2);
+					sf[l] = lookup_keys(mScalingTimes, mScalingRanges[i].mOffset, mScalingRanges[i].mCount, time, aState.mScalingCursors[i], glm::vec3{ 1.0f },
+						[&](uint32_t aKey) { return mScalingValues[aKey]; }, vec1, vec2);
+				}
+				r1[0][l] = quat1.x; r1[1][l] = quat1.y; r1[2][l] = quat1.z; r1[3][l] = quat1.w;
+				r2[0][l] = quat2.x; r2[1][l] = quat2.y; r2[2][l] = quat2.z; r2[3][l] = quat2.w;
+				for (int c = 0; c < 3; ++c) { s1[c][l] = vec1[c]; s2[c][l] = vec2[c]; }
+			}
+
+			// Interpolate translation and scale:
+			alignas(32) float t[3][L], s[3][L];
+			for (int c = 0; c < 3; ++c) {
+				for (size_t l = 0; l < L; ++l) {
+					t[c][l] = t1[c][l] + tf[l] * (t2[c][l] - t1[c][l]);
+					s[c][l] = s1[c][l] + sf[l] * (s2[c][l] - s1[c][l]);
+				}
+			}
+
+			// Interpolate rotation with slerp. The slerp weights are computed with a polynomial approximation of sin(t * angle) / sin(angle)
+			// (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP"), which does not need any trigonometric functions and can
+			// be vectorized. It is accurate to float precision for interpolation factors within [0, 1]. Factors outside that range only
+			// occur when extrapolating before a channel's first key, which is computed exactly, with the same formula as glm::slerp.
+			alignas(32) float sign[L], xm1[L], d[L], w1[L], w2[L], q[4][L];
+			for (size_t l = 0; l < L; ++l) {
+				const float cosTheta = r1[0][l] * r2[0][l] + r1[1][l] * r2[1][l] + r1[2][l] * r2[2][l] + r1[3][l] * r2[3][l];
+				sign[l] = cosTheta < 0.0f ? -1.0f : 1.0f;
+				xm1[l] = cosTheta * sign[l] - 1.0f;
+				d[l] = 1.0f - rf[l];
+				w1[l] = 1.0f;
+				w2[l] = 1.0f;
+			}
+			for (int k = static_cast<int>(sSlerpCoefficientCount) - 1; k >= 0; --k) {
+				for (size_t l = 0; l < L; ++l) {
+					w1[l] = 1.0f + (sSlerpU[k] * d[l] * d[l] - sSlerpV[k]) * xm1[l] * w1[l];
+					w2[l] = 1.0f + (sSlerpU[k] * rf[l] * rf[l] - sSlerpV[k]) * xm1[l] * w2[l];
+				}
+			}
+			for (size_t l = 0; l < L; ++l) {
+				w1[l] *= d[l];
+				w2[l] *= rf[l] * sign[l];
+			}
+			for (size_t l = 0; l < L; ++l) {
+				if (rf[l] < 0.0f || rf[l] > 1.0f) {
+					const float cosTheta = xm1[l] + 1.0f;
+					if (cosTheta > 1.0f - std::numeric_limits<float>::epsilon()) {
+						w1[l] = 1.0f - rf[l];
+						w2[l] = rf[l] * sign[l];
+					}
+					else {
+						const float angle = std::acos(cosTheta);
+						const float invSinAngle = 1.0f / std::sin(angle);
+						w1[l] = std::sin((1.0f - rf[l]) * angle) * invSinAngle;
+						w2[l] = std::sin(rf[l] * angle) * invSinAngle * sign[l];
+					}
+				}
+			}
+			for (int c = 0; c < 4; ++c) {
+				for (size_t l = 0; l < L; ++l) {
+					q[c][l] = w1[l] * r1[c][l] + w2[l] * r2[c][l];
+				}
+			}
+			alignas(32) float invLength[L];
+			for (size_t l = 0; l < L; ++l) {
+				invLength[l] = 1.0f / std::sqrt(q[0][l] * q[0][l] + q[1][l] * q[1][l] + q[2][l] * q[2][l] + q[3][l] * q[3][l]);
+			}
+			for (int c = 0; c < 4; ++c) {
+				for (size_t l = 0; l < L; ++l) {
+					q[c][l] *= invLength[l];
+				}
+			}
+
+			// Scatter:
+			const auto batchEnd = std::min(batchBegin + static_cast<uint32_t>(L), n);
+			for (uint32_t i = batchBegin; i < batchEnd; ++i) {
+				const auto l = i - batchBegin;
+				aPose.mTranslations[i] = glm::vec3{ t[0][l], t[1][l], t[2][l] };
+				aPose.mRotations[i] = glm::quat{ q[3][l], q[0][l], q[1][l], q[2][l] };
+				aPose.mScales[i] = glm::vec3{ s[0][l], s[1][l], s[2][l] };
+			}
+		}
+	}
+
+	template <size_t L>
+	void packed_animation::compose(const animation_pose& aPose, packed_animation_state& aState) const
+	{
+		static_assert(L == 4 || L == 8, "packed_animation can only be evaluated with 4 or 8 lanes.");
+
+		const auto n = static_cast<uint32_t>(number_of_nodes());
+		if (aState.mGlobalTransforms.size() != n) {
+			throw avk::logic_error("The evaluation state has not been created for this packed_animation.");
+		}
+		if (aPose.mTranslations.size() != n || aPose.mRotations.size() != n || aPose.mScales.size() != n) {
+			throw avk::logic_error("The pose has not been created for this packed_animation.");
+		}
+
+		for (uint32_t batchBegin = 0; batchBegin < n; batchBegin += static_cast<uint32_t>(L)) {
+			// Local transforms and parent transforms of this batch's nodes, one lane per node:
+			alignas(32) float t[3][L], q[4][L], s[3][L];
+			alignas(32) float p[16][L];
+
+			// Gather. Lanes past the last node replicate the last node.
+			for (size_t l = 0; l < L; ++l) {
+				const auto i = std::min(batchBegin + static_cast<uint32_t>(l), n - 1);
+				const auto& translation = aPose.mTranslations[i];
+				const auto& rotation = aPose.mRotations[i];
+				const auto& scale = aPose.mScales[i];
+				for (int c = 0; c < 3; ++c) { t[c][l] = translation[c]; s[c][l] = scale[c]; }
+				q[0][l] = rotation.x; q[1][l] = rotation.y; q[2][l] = rotation.z; q[3][l] = rotation.w;
+				const float* parent = glm::value_ptr(mParentTransforms[i]);
+				for (int e = 0; e < 16; ++e) { p[e][l] = parent[e]; }
+			}
+
+			// Build the local TRS matrices (column-major, the last row is implicitly (0, 0, 0, 1)), see matrix_from_transforms:
+			alignas(32) float m[12][L];
+			for (size_t l = 0; l < L; ++l) {
+				const float x = q[0][l], y = q[1][l], z = q[2][l], w = q[3][l];
+				m[0][l]  = (1.0f - 2.0f * (y * y + z * z)) * s[0][l];
+				m[1][l]  = (2.0f * (x * y + w * z)) * s[0][l];
+				m[2][l]  = (2.0f * (x * z - w * y)) * s[0][l];
+				m[3][l]  = (2.0f * (x * y - w * z)) * s[1][l];
+				m[4][l]  = (1.0f - 2.0f * (x * x + z * z)) * s[1][l];
+				m[5][l]  = (2.0f * (y * z + w * x)) * s[1][l];
+				m[6][l]  = (2.0f * (x * z + w * y)) * s[2][l];
+				m[7][l]  = (2.0f * (y * z - w * x)) * s[2][l];
+				m[8][l]  = (1.0f - 2.0f * (x * x + y * y)) * s[2][l];
+				m[9][l]  = t[0][l];
+				m[10][l] = t[1][l];
+				m[11][l] = t[2][l];
+			}
+
+			// Apply the parent transforms, i.e. compute parentTransform * localTransform per lane:
+			alignas(32) float result[16][L];
+			for (int col = 0; col < 4; ++col) {
+				for (int row = 0; row < 4; ++row) {
+					const auto* m0 = m[col * 3];
+					const auto* m1 = m[col * 3 + 1];
+					const auto* m2 = m[col * 3 + 2];
+					const auto* translation = col == 3 ? p[12 + row] : nullptr;
+					for (size_t l = 0; l < L; ++l) {
+						result[col * 4 + row][l] = p[row][l] * m0[l] + p[4 + row][l] * m1[l] + p[8 + row][l] * m2[l];
+					}
+					if (nullptr != translation) {
+						for (size_t l = 0; l < L; ++l) {
+							result[col * 4 + row][l] += translation[l];
+						}
+					}
+				}
+			}
+
+			// Scatter:
+			const auto batchEnd = std::min(batchBegin + static_cast<uint32_t>(L), n);
+			for (uint32_t i = batchBegin; i < batchEnd; ++i) {
+				float* target = glm::value_ptr(aState.mGlobalTransforms[i]);
+				for (int e = 0; e < 16; ++e) {
+					target[e] = result[e][i - batchBegin];
+				}
+			}
+		}
+
+		// Concatenate with the animated parents' global transforms, which have always been computed before their children's:
+		for (uint32_t i = 0; i < n; ++i) {
+			if (sNoParent != mParentIndices[i]) {
+				aState.mGlobalTransforms[i] = aState.mGlobalTransforms[mParentIndices[i]] * aState.mGlobalTransforms[i];
+			}
+		}
+	}
+
+
+	template <size_t L>
+	void packed_animation::evaluate(double aTimeInTicks, packed_animation_state& aState) const
+	{
+		sample_local_pose<L>(aTimeInTicks, aState.mLocalPose, aState);
+		compose<L>(aState.mLocalPose, aState);
+	}
+
+	template <size_t L>
+	void packed_animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, packed_animation_state& aState) const
+	{
+		validate_clip(aClip);
+		evaluate<L>(aTime * aClip.mTicksPerSecond, aState);
+		write_bone_matrices(aState, aTargetSpace, aTargetMemory);
+	}
+
+	void packed_animation::write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const
+	{
+		const auto& globalTransforms = aState.mGlobalTransforms;
+		const auto n = mBoneTargetIndices.size();
+		switch (aTargetSpace) {
+		case bone_matrices_space::mesh_space:
+			for (size_t i = 0; i < n; ++i) {
+				aTargetMemory[mBoneTargetIndices[i]] = mBoneInverseMeshRootMatrices[i] * globalTransforms[mBoneNodeIndices[i]] * mBoneInverseBindPoseMatrices[i];
+			}
+			break;
+		case bone_matrices_space::model_space:
+			for (size_t i = 0; i < n; ++i) {
+				aTargetMemory[mBoneTargetIndices[i]] = globalTransforms[mBoneNodeIndices[i]] * mBoneInverseBindPoseMatrices[i];
+			}
+			break;
+		default:
+			throw avk::runtime_error("Unknown target space value.");
+		}
+	}
+
+	template <typename T, typename C>
+	void packed_animation::write_converted_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, T* aTargetMemory, C aConvert) const
+	{
+		const auto& globalTransforms = aState.mGlobalTransforms;
+		const auto n = mBoneTargetIndices.size();
+		switch (aTargetSpace) {
+		case bone_matrices_space::mesh_space:
+			for (size_t i = 0; i < n; ++i) {
+				aTargetMemory[mBoneTargetIndices[i]] = aConvert(mBoneInverseMeshRootMatrices[i] * globalTransforms[mBoneNodeIndices[i]] * mBoneInverseBindPoseMatrices[i]);
+			}
+			break;
+		case bone_matrices_space::model_space:
+			for (size_t i = 0; i < n; ++i) {
+				aTargetMemory[mBoneTargetIndices[i]] = aConvert(globalTransforms[mBoneNodeIndices[i]] * mBoneInverseBindPoseMatrices[i]);
+			}
+			break;
+		default:
+			throw avk::runtime_error("Unknown target space value.");
+		}
+	}
+
+	void packed_animation::write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::mat3x4* aTargetMemory) const
+	{
+		write_converted_bone_matrices(aState, aTargetSpace, aTargetMemory, to_bone_matrix_3x4);
+	}
+
+	void packed_animation::write_bone_matrices(const packed_animation_state& aState, bone_matrices_space aTargetSpace, glm::dualquat* aTargetMemory) const
+	{
+		write_converted_bone_matrices(aState, aTargetSpace, aTargetMemory, to_bone_dual_quaternion);
+	}
+
+	size_t packed_animation::bone_matrix_buffer_size() const
+	{
+		return mBoneTargetIndices.empty() ? size_t{ 0 } : *std::max_element(mBoneTargetIndices.begin(), mBoneTargetIndices.end()) + 1;
+	}
+
+	template <size_t L>
+	void packed_animation::animate_instances_into_single_target_buffer(const animation_clip_data& aClip, std::span<const double> aTimes, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, std::optional<size_t> aInstanceStride, std::vector<packed_animation_state>& aStates, thread_pool& aThreadPool) const
+	{
+		validate_clip(aClip);
+		const auto numMatrices = bone_matrix_buffer_size();
+		const auto instanceStride = aInstanceStride.value_or(numMatrices);
+		if (instanceStride < numMatrices) {
+			throw avk::runtime_error("The instance stride must not be smaller than the number of bone matrices of an instance.");
+		}
+
+		const auto numInstances = aTimes.size();
+		if (aStates.size() != numInstances) {
+			aStates.resize(numInstances);
+		}
+		const auto numNodes = number_of_nodes();
+		for (auto& state : aStates) {
+			if (state.mGlobalTransforms.size() != numNodes) {
+				state = create_state();
+			}
+		}
+
+		const auto numTasks = (numInstances + sInstancesPerTask - 1) / sInstancesPerTask;
+		aThreadPool.parallel_for(numTasks, [&](size_t aTask) {
+			const auto end = std::min((aTask + 1) * sInstancesPerTask, numInstances);
+			for (size_t i = aTask * sInstancesPerTask; i < end; ++i) {
+				animate_into_single_target_buffer<L>(aClip, aTimes[i], aTargetSpace, aTargetMemory + i * instanceStride, aStates[i]);
+			}
+		});
+	}
+
+	void blend_poses(const animation_pose& aFrom, const animation_pose& aTo, float aWeight, animation_pose& aResult, std::span<const float> aMask)
+	{
+		validate_poses(aFrom, aTo, aMask);
+		const auto n = aFrom.mTranslations.size();
+		aResult.mTranslations.resize(n);
+		aResult.mRotations.resize(n);
+		aResult.mScales.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			const float w = aMask.empty() ? aWeight : aWeight * aMask[i];
+			aResult.mTranslations[i] = glm::mix(aFrom.mTranslations[i], aTo.mTranslations[i], w);
+			aResult.mRotations[i] = nlerp(aFrom.mRotations[i], aTo.mRotations[i], w);
+			aResult.mScales[i] = glm::mix(aFrom.mScales[i], aTo.mScales[i], w);
+		}
+	}
+
+	animation_pose make_additive_pose(const animation_pose& aPose, const animation_pose& aReferencePose)
+	{
+		validate_poses(aPose, aReferencePose, {});
+		const auto n = aPose.mTranslations.size();
+		animation_pose result;
+		result.mTranslations.resize(n);
+		result.mRotations.resize(n);
+		result.mScales.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			result.mTranslations[i] = aPose.mTranslations[i] - aReferencePose.mTranslations[i];
+			result.mRotations[i] = glm::normalize(aPose.mRotations[i] * glm::inverse(aReferencePose.mRotations[i]));
+			result.mScales[i] = aPose.mScales[i] / aReferencePose.mScales[i];
+		}
+		return result;
+	}
+
+	void apply_additive_pose(const animation_pose& aBase, const animation_pose& aAdditive, float aWeight, animation_pose& aResult, std::span<const float> aMask)
+	{
+		validate_poses(aBase, aAdditive, aMask);
+		const auto n = aBase.mTranslations.size();
+		aResult.mTranslations.resize(n);
+		aResult.mRotations.resize(n);
+		aResult.mScales.resize(n);
+		const glm::quat identity{ 1.0f, 0.0f, 0.0f, 0.0f };
+		for (size_t i = 0; i < n; ++i) {
+			const float w = aMask.empty() ? aWeight : aWeight * aMask[i];
+			aResult.mTranslations[i] = aBase.mTranslations[i] + aAdditive.mTranslations[i] * w;
+			aResult.mRotations[i] = glm::normalize(nlerp(identity, aAdditive.mRotations[i], w) * aBase.mRotations[i]);
+			aResult.mScales[i] = aBase.mScales[i] * glm::mix(glm::vec3{ 1.0f }, aAdditive.mScales[i], w);
+		}
+	}
+
+	template void packed_animation::sample_local_pose<4>(double, animation_pose&, packed_animation_state&) const;
+	template void packed_animation::sample_local_pose<8>(double, animation_pose&, packed_animation_state&) const;
+	template void packed_animation::compose<4>(const animation_pose&, packed_animation_state&) const;
+	template void packed_animation::compose<8>(const animation_pose&, packed_animation_state&) const;
+	template void packed_animation::evaluate<4>(double, packed_animation_state&) const;
+	template void packed_animation::evaluate<8>(double, packed_animation_state&) const;
+	template void packed_animation::animate_into_single_target_buffer<4>(const animation_clip_data&, double, bone_matrices_space, glm::mat4*, packed_animation_state&) const;
+	template void packed_animation::animate_into_single_target_buffer<8>(const animation_clip_data&, double, bone_matrices_space, glm::mat4*, packed_animation_state&) const;
+	template void packed_animation::animate_instances_into_single_target_buffer<4>(const animation_clip_data&, std::span<const double>, bone_matrices_space, glm::mat4*, std::optional<size_t>, std::vector<packed_animation_state>&, thread_pool&) const;
+	template void packed_animation::animate_instances_into_single_target_buffer<8>(const animation_clip_data&, std::span<const double>, bone_matrices_space, glm::mat4*, std::optional<size_t>, std::vector<packed_animation_state>&, thread_pool&) const;
+}
@@ -0,0 +1,57 @@
+#include "thread_pool.hpp"
+
+namespace avk
+{
+	thread_pool::thread_pool(size_t aNumThreads)
+	{
+		const auto n = std::max(aNumThreads, size_t{ 1 });
+		mWorkers.reserve(n);
+		for (size_t i = 0; i < n; ++i) {
+			mWorkers.emplace_back([this]() { worker_loop(); });
+		}
+	}
+
+	thread_pool::~thread_pool()
+	{
+		{
+			std::scoped_lock lock(mMutex);
+			mStopping = true;
+		}
+		mTaskAvailable.notify_all();
+		for (auto& worker : mWorkers) {
+			worker.join();
+		}
+	}
+
+	thread_pool& thread_pool::shared()
+	{
+		static thread_pool sSharedPool;
+		return sSharedPool;
+	}
+
+	void thread_pool::enqueue(std::function<void()> aTask)
+	{
+		{
+			std::scoped_lock lock(mMutex);
+			mTasks.push(std::move(aTask));
+		}
+		mTaskAvailable.notify_one();
+	}
+
+	void thread_pool::worker_loop()
+	{
+		for (;;) {
+			std::function<void()> task;
+			{
+				std::unique_lock lock(mMutex);
+				mTaskAvailable.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+				if (mTasks.empty()) {
+					return; // => stopping and nothing left to do
+				}
+				task = std::move(mTasks.front());
+				mTasks.pop();
+			}
+			task();
+		}
+	}
+}
@@ -0,0 +1,48 @@
+// Decode functions for meshlet data in the compact format, as generated by
+// avk::convert_for_gpu_usage<avk::meshlet_compact_gpu_data, NV, NI>.
+// For details about the format, see meshlet_compact_gpu_data in meshlet_helpers.hpp.
+// Vertex counts and triangle counts are at most 255, i.e. mIndexBits is at most 8.
+//
+// Before including this file, define COMPACT_MESHLET_DATA(i) as an expression which
+// reads the i-th uint of the meshlet data array. Since it is expanded within the functions
+// below, it can only refer to global variables, e.g.:
+//   uint compactMeshletBufferIndex; // <- set in main()
+//   #define COMPACT_MESHLET_DATA(i) indicesBuffers[compactMeshletBufferIndex].mIndices[i]
+
+struct meshlet_compact
+{
+	uint mDataOffset;
+	uint mVertexBase;
+	uint8_t mVertexCount;
+	uint8_t mPrimitiveCount;
+	uint8_t mVertexDeltaBits;
+	uint8_t mIndexBits;
+};
+
+// Reads the value with the given number of bits (1 to 32) which starts at the given bit offset of the bit stream at dataOffset
+uint compact_meshlet_read_bits(uint dataOffset, uint bitOffset, uint numBits)
+{
+	uint word  = dataOffset + bitOffset / 32u;
+	uint shift = bitOffset % 32u;
+	uint bits  = COMPACT_MESHLET_DATA(word) >> shift;
+	if (shift + numBits > 32u) {
+		// The value straddles two uints:
+		bits |= COMPACT_MESHLET_DATA(word + 1u) << (32u - shift);
+	}
+	return numBits == 32u ? bits : (bits & ((1u << numBits) - 1u));
+}
+
+// Returns the index into the vertex buffers of the meshlet's vertex with the given index
+uint compact_meshlet_vertex_index(uint dataOffset, uint vertexBase, uint vertexDeltaBits, uint vertexIndex)
+{
+	return vertexBase + compact_meshlet_read_bits(dataOffset, vertexIndex * vertexDeltaBits, vertexDeltaBits);
+}
+
+// Returns the three meshlet-local vertex indices of the meshlet's triangle with the given index
+uvec3 compact_meshlet_triangle(uint dataOffset, uint vertexCount, uint vertexDeltaBits, uint indexBits, uint triangleIndex)
+{
+	uint trianglesOffset = dataOffset + (vertexCount * vertexDeltaBits + 31u) / 32u;
+	uint bits = compact_meshlet_read_bits(trianglesOffset, triangleIndex * 3u * indexBits, 3u * indexBits);
+	uint mask = (1u << indexBits) - 1u;
+	return uvec3(bits & mask, (bits >> indexBits) & mask, (bits >> (2u * indexBits)) & mask);
+}
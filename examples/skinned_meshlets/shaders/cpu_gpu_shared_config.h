@@ -2,5 +2,11 @@
 #define CPU_GPU_SHARED_CONFIG_H
 
 #define USE_REDIRECTED_GPU_DATA 1
+// Only effective if USE_REDIRECTED_GPU_DATA is 1: Use the bit-packed avk::meshlet_compact_gpu_data instead of
+// avk::meshlet_redirected_gpu_data. The mesh shaders decode it with the functions from compact_meshlet.glsl.
+#define USE_COMPACT_GPU_DATA 0
+// Store the bone matrices in the compact 3x4 format (see avk::to_bone_matrix_3x4), which omits their constant last row
+// and thereby reduces the size of the bone matrices buffers and the bandwidth of the mesh shaders' bone fetches by 25%.
+#define USE_BONE_MATRICES_3X4 0
 
 #endif // CPU_GPU_SHARED_CONFIG_H
@@ -19,3 +19,74 @@ vec3 bone_transform(mat4 BM0, mat4 BM1, mat4 BM2, mat4 BM3, vec4 weights, vec3 n
 	return weights[0] * tr0 + weights[1] * tr1 + weights[2] * tr2 + weights[3] * tr3;
 }
 
+// Same as above, but with 3x4 bone matrices as written by avk::to_bone_matrix_3x4, i.e. column i contains row i of the affine bone matrix
+vec4 bone_transform(mat3x4 BM0, mat3x4 BM1, mat3x4 BM2, mat3x4 BM3, vec4 weights, vec4 positionToTransform)
+{
+	weights.w = 1.0 - dot(weights.xyz, vec3(1.0, 1.0, 1.0));
+	vec3 tr0 = positionToTransform * BM0;
+	vec3 tr1 = positionToTransform * BM1;
+	vec3 tr2 = positionToTransform * BM2;
+	vec3 tr3 = positionToTransform * BM3;
+	return vec4(weights[0] * tr0 + weights[1] * tr1 + weights[2] * tr2 + weights[3] * tr3, positionToTransform.w);
+}
+
+vec3 bone_transform(mat3x4 BM0, mat3x4 BM1, mat3x4 BM2, mat3x4 BM3, vec4 weights, vec3 normalToTransform)
+{
+	weights.w = 1.0 - dot(weights.xyz, vec3(1.0, 1.0, 1.0));
+	vec3 tr0 = vec4(normalToTransform, 0.0) * BM0;
+	vec3 tr1 = vec4(normalToTransform, 0.0) * BM1;
+	vec3 tr2 = vec4(normalToTransform, 0.0) * BM2;
+	vec3 tr3 = vec4(normalToTransform, 0.0) * BM3;
+	return weights[0] * tr0 + weights[1] * tr1 + weights[2] * tr2 + weights[3] * tr3;
+}
+
+// Unit dual quaternion as written by avk::to_bone_dual_quaternion (same memory layout as glm::dualquat):
+// The real part is the rotation, the dual part encodes the translation. Both are stored as (x, y, z, w).
+struct bone_dual_quaternion
+{
+	vec4 real;
+	vec4 dual;
+};
+
+// Dual quaternion linear blending: The dual quaternions are flipped into the hemisphere of the first one,
+// summed up with the given weights, and normalized. In contrast to blending matrices, this preserves the volume around joints.
+bone_dual_quaternion blend_bone_dual_quaternions(bone_dual_quaternion DQ0, bone_dual_quaternion DQ1, bone_dual_quaternion DQ2, bone_dual_quaternion DQ3, vec4 weights)
+{
+	weights.w = 1.0 - dot(weights.xyz, vec3(1.0, 1.0, 1.0));
+	weights.y = dot(DQ0.real, DQ1.real) < 0.0 ? -weights.y : weights.y;
+	weights.z = dot(DQ0.real, DQ2.real) < 0.0 ? -weights.z : weights.z;
+	weights.w = dot(DQ0.real, DQ3.real) < 0.0 ? -weights.w : weights.w;
+	bone_dual_quaternion result;
+	result.real = weights[0] * DQ0.real + weights[1] * DQ1.real + weights[2] * DQ2.real + weights[3] * DQ3.real;
+	result.dual = weights[0] * DQ0.dual + weights[1] * DQ1.dual + weights[2] * DQ2.dual + weights[3] * DQ3.dual;
+	float invLength = 1.0 / length(result.real);
+	result.real *= invLength;
+	result.dual *= invLength;
+	return result;
+}
+
+// Rotates the given vector with the real part of a unit dual quaternion
+vec3 dual_quaternion_rotate(bone_dual_quaternion DQ, vec3 v)
+{
+	return v + 2.0 * cross(DQ.real.xyz, cross(DQ.real.xyz, v) + DQ.real.w * v);
+}
+
+// Rotates and translates the given position with a unit dual quaternion
+vec3 dual_quaternion_transform_position(bone_dual_quaternion DQ, vec3 p)
+{
+	vec3 translation = 2.0 * (DQ.real.w * DQ.dual.xyz - DQ.dual.w * DQ.real.xyz + cross(DQ.real.xyz, DQ.dual.xyz));
+	return dual_quaternion_rotate(DQ, p) + translation;
+}
+
+// Same as the mat4 variants above, but with dual quaternion linear blending of the bones' dual quaternions
+vec4 bone_transform(bone_dual_quaternion DQ0, bone_dual_quaternion DQ1, bone_dual_quaternion DQ2, bone_dual_quaternion DQ3, vec4 weights, vec4 positionToTransform)
+{
+	bone_dual_quaternion blended = blend_bone_dual_quaternions(DQ0, DQ1, DQ2, DQ3, weights);
+	return vec4(dual_quaternion_transform_position(blended, positionToTransform.xyz), positionToTransform.w);
+}
+
+vec3 bone_transform(bone_dual_quaternion DQ0, bone_dual_quaternion DQ1, bone_dual_quaternion DQ2, bone_dual_quaternion DQ3, vec4 weights, vec3 normalToTransform)
+{
+	bone_dual_quaternion blended = blend_bone_dual_quaternions(DQ0, DQ1, DQ2, DQ3, weights);
+	return dual_quaternion_rotate(blended, normalToTransform);
+}
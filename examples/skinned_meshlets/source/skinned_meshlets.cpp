@@ -2,6 +2,7 @@
 #include "imgui.h"
 
 #include "configure_and_compose.hpp"
+#include "gpu_animation_helpers.hpp"
 #include "imgui_manager.hpp"
 #include "invokee.hpp"
 #include "material_image_helpers.hpp"
@@ -15,6 +16,8 @@
  *	Please note: This example can provide the geometry data in two different formats:
  *	 - USE_REDIRECTED_GPU_DATA 0 ...
  *	 - USE_REDIRECTED_GPU_DATA 1 ...
+ *	With USE_REDIRECTED_GPU_DATA 1, USE_COMPACT_GPU_DATA 1 selects the bit-packed avk::meshlet_compact_gpu_data.
+ *	USE_BONE_MATRICES_3X4 1 stores the bone matrices in the compact 3x4 format instead of as glm::mat4.
  *	Change the mode for both, C++ and GLSL, in cpu_gpu_shared_config.h
  */
 #include "../shaders/cpu_gpu_shared_config.h"
@@ -74,7 +77,11 @@ class skinned_meshlets_app : public avk::invokee
 
 	struct additional_animated_model_data
 	{
+#if USE_BONE_MATRICES_3X4
+		std::vector<glm::mat3x4> mBoneMatricesAni;
+#else
 		std::vector<glm::mat4> mBoneMatricesAni;
+#endif
 	};
 
 	/** Helper struct for the animations. */
@@ -93,6 +100,7 @@ class skinned_meshlets_app : public avk::invokee
 		uint32_t mNumBoneMatrices;
 		size_t mBoneMatricesBufferIndex;
 		avk::animation mAnimation;
+		avk::packed_animation_gpu_buffers mGpuAnimation;
 
 		[[nodiscard]] double start_sec() const { return mClip.mStartTicks / mClip.mTicksPerSecond; }
 		[[nodiscard]] double end_sec() const { return mClip.mEndTicks / mClip.mTicksPerSecond; }
@@ -110,6 +118,8 @@ class skinned_meshlets_app : public avk::invokee
 
 #if !USE_REDIRECTED_GPU_DATA
 		avk::meshlet_gpu_data<sNumVertices, sNumIndices> mGeometry;
+#elif USE_COMPACT_GPU_DATA
+		avk::meshlet_compact_gpu_data mGeometry;
 #else
 		avk::meshlet_redirected_gpu_data mGeometry;
 #endif
@@ -210,6 +220,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		std::vector<loaded_data_for_draw_call> dataForDrawCall;
 		std::vector<meshlet> meshletsGeometry;
 		std::vector<animated_model_data> animatedModels;
+		std::vector<avk::recorded_commands_t> animationUploadCommands;
 
 		// Crab-specific animation config: (Needs to be adapted for other models)
 		const uint32_t cAnimationIndex = 0;
@@ -243,8 +254,19 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				allMatConfigs.push_back(pair.first);
 			}
 
-			// prepare the animation for the current entry
-			curEntry.mAnimation = curModel->prepare_animation(curEntry.mClip.mAnimationIndex, meshIndicesInOrder);
+			// prepare the animation for the current entry, s.t. nodes which do not change during the clip are skipped
+			curEntry.mAnimation = curModel->prepare_animation(curEntry.mClip, meshIndicesInOrder);
+
+			// prepare the keys and the hierarchy for evaluating the animation on the GPU, which produces model space bone matrices like the CPU path in render():
+#if USE_CACHE
+			avk::serializer animationSerializer("gpu_animation-" + std::to_string(i) + ".cache");
+			auto gpuAnimationData = avk::convert_for_gpu_usage_cached(animationSerializer, avk::packed_animation(curEntry.mAnimation), avk::bone_matrices_space::model_space);
+#else
+			auto gpuAnimationData = avk::convert_for_gpu_usage(avk::packed_animation(curEntry.mAnimation), avk::bone_matrices_space::model_space);
+#endif
+			auto [gpuAnimation, gpuAnimationCommands] = avk::create_gpu_buffers(gpuAnimationData);
+			curEntry.mGpuAnimation = std::move(gpuAnimation);
+			animationUploadCommands.insert(animationUploadCommands.end(), gpuAnimationCommands.begin(), gpuAnimationCommands.end());
 
 			// Generate meshlets for each submesh of the current loaded model. Load all it's data into the drawcall for later use.
 			for (size_t mpos = 0; mpos < meshIndicesInOrder.size(); mpos++) {
@@ -274,8 +296,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				drawCallData.mNormals = avk::get_normals(selection);
 				drawCallData.mTexCoords = avk::get_2d_texture_coordinates(selection, 0);
 				// Get bone indices and weights too
-				drawCallData.mBoneIndices = avk::get_bone_indices_for_single_target_buffer(selection, meshIndicesInOrder);
-				drawCallData.mBoneWeights = avk::get_bone_weights(selection);
+				std::tie(drawCallData.mBoneWeights, drawCallData.mBoneIndices) = avk::get_bone_weights_and_indices_for_single_target_buffer(selection, meshIndicesInOrder);
 
 				// create selection for the meshlets
 				auto meshletSelection = avk::make_models_and_mesh_indices_selection(curModel, meshIndex);
@@ -288,6 +309,14 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 #else
 				auto [gpuMeshlets, _] = avk::convert_for_gpu_usage<avk::meshlet_gpu_data<sNumVertices, sNumIndices>, sNumVertices, sNumIndices>(cpuMeshlets);
 #endif
+#elif USE_COMPACT_GPU_DATA
+#if USE_CACHE
+				avk::serializer serializer("compact_meshlets-" + meshname + "-" + std::to_string(mpos) + ".cache");
+				auto [gpuMeshlets, gpuIndicesData] = avk::convert_for_gpu_usage_cached<avk::meshlet_compact_gpu_data, sNumVertices, sNumIndices>(serializer, cpuMeshlets);
+#else
+				auto [gpuMeshlets, gpuIndicesData] = avk::convert_for_gpu_usage<avk::meshlet_compact_gpu_data, sNumVertices, sNumIndices>(cpuMeshlets);
+#endif
+				drawCallData.mIndicesData = std::move(gpuIndicesData.value());
 #else
 #if USE_CACHE
 				avk::serializer serializer("redirected_meshlets-" + meshname + "-" + std::to_string(mpos) + ".cache");
@@ -327,6 +356,11 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 					avk::memory_usage::host_coherent, {},
 					avk::storage_buffer_meta::create_from_data(std::get<additional_animated_model_data>(animModel).mBoneMatricesAni)
 				));
+				// the animation time, which is all that needs to be uploaded if the animation is evaluated on the GPU:
+				mAnimationTimesBuffers[cfi].push_back(avk::context().create_buffer(
+					avk::memory_usage::host_coherent, {},
+					avk::storage_buffer_meta::create_from_size(sizeof(float))
+				));
 			}
 		}
 		// create all the buffers for our drawcall data
@@ -352,7 +386,8 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 
 		avk::context().record_and_submit_with_fence({
 			mMeshletsBuffer->fill(meshletsGeometry.data(), 0),
-			matCommands
+			matCommands,
+			animationUploadCommands
 		}, *mQueue)->wait_until_signalled();
 
 		// One for each concurrent frame
@@ -431,9 +466,25 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			meshShaderProps.maxPreferredTaskWorkGroupInvocations,
 			meshShaderProps.maxPreferredMeshWorkGroupInvocations
 		);
+		// Create the compute pipeline which evaluates the animations on the GPU:
+		const auto& firstGpuAnimation = std::get<animated_model_data>(mAnimatedModels.front()).mGpuAnimation;
+		mAnimationPipeline = avk::context().create_compute_pipeline_for(
+			"shaders/animate_bones.comp",
+			avk::push_constant_binding_data{ avk::shader_type::compute, 0, sizeof(avk::packed_animation_push_constants) },
+			avk::descriptor_binding(0, 0, firstGpuAnimation.mNodes),
+			avk::descriptor_binding(0, 1, firstGpuAnimation.mLevelOffsets),
+			avk::descriptor_binding(0, 2, firstGpuAnimation.mKeyTimes),
+			avk::descriptor_binding(0, 3, firstGpuAnimation.mKeyValues),
+			avk::descriptor_binding(0, 4, firstGpuAnimation.mBones),
+			avk::descriptor_binding(0, 5, firstGpuAnimation.mGlobalTransforms),
+			avk::descriptor_binding(0, 6, mAnimationTimesBuffers[0][0]),
+			avk::descriptor_binding(0, 7, mBoneMatricesBuffersAni[0][0])
+		);
+
 		// we want to use an updater, so create one:
 		mUpdater.emplace();
 		mUpdater->on(avk::shader_files_changed_event(mPipelineExt.as_reference())).update(mPipelineExt);
+		mUpdater->on(avk::shader_files_changed_event(mAnimationPipeline.as_reference())).update(mAnimationPipeline);
 
 		if (avk::context().supports_mesh_shader_nv(avk::context().physical_device())) {
 			vk::PhysicalDeviceMeshShaderPropertiesNV meshShaderPropsNv{};
@@ -521,6 +572,9 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 					ImGui::Separator();
 				}
 
+				ImGui::Checkbox("Animate on the GPU", &mAnimateOnGpu);
+				ImGui::Separator();
+
 				// Select the range of meshlets to be rendered:
 				ImGui::Checkbox("Highlight meshlets", &mHighlightMeshlets);
 				ImGui::Text("Select meshlets to be rendered:");
@@ -566,6 +620,12 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			auto& clip = std::get<animated_model_data>(model).mClip;
 			const auto doubleTime = fmod(time().absolute_time_dp(), std::get<animated_model_data>(model).duration_sec() * 2);
 			auto time = glm::lerp(std::get<animated_model_data>(model).start_sec(), std::get<animated_model_data>(model).end_sec(), (doubleTime > std::get<animated_model_data>(model).duration_sec() ? doubleTime - std::get<animated_model_data>(model).duration_sec() : doubleTime) / std::get<animated_model_data>(model).duration_sec());
+			if (mAnimateOnGpu) {
+				// The compute shader evaluates the animation => only upload the time:
+				const auto timeSec = static_cast<float>(time);
+				auto emptyTimeCmd = mAnimationTimesBuffers[inFlightIndex][std::get<animated_model_data>(model).mBoneMatricesBufferIndex]->fill(&timeSec, 0);
+				continue;
+			}
 			auto targetMemory = std::get<additional_animated_model_data>(model).mBoneMatricesAni.data();
 
 			// Use lambda option 1 that takes as parameters: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix
@@ -573,7 +633,11 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				// Construction of the bone matrix for this node:
 				//   1. Bring vertex into bone space
 				//   2. Apply transformaton in bone space => MODEL SPACE
+#if USE_BONE_MATRICES_3X4
+				targetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = to_bone_matrix_3x4(aTransformMatrix * aInverseBindPoseMatrix);
+#else
 				targetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aTransformMatrix * aInverseBindPoseMatrix;
+#endif
 			});
 		}
 
@@ -605,6 +669,38 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			mPipelineStats = mPipelineStatsPool->get_results<uint64_t, 3>(inFlightIndex, 1, vk::QueryResultFlagBits::e64);
 		}
 
+		// Either evaluate the animations with the compute shader, writing the bone matrices directly into the buffers of the
+		// current frame, or upload the bone matrices which have been computed on the CPU:
+		std::vector<recorded_commands_t> animationCommands;
+		if (mAnimateOnGpu) {
+			// The global transforms are scratch memory which is shared by all frames in flight:
+			animationCommands.push_back(sync::global_memory_barrier(stage::compute_shader >> stage::compute_shader, access::shader_write >> access::shader_read | access::shader_write));
+			animationCommands.push_back(command::bind_pipeline(mAnimationPipeline.as_reference()));
+			for (const auto& model : mAnimatedModels) {
+				const auto& animModel = std::get<animated_model_data>(model);
+				const auto& gpuAnimation = animModel.mGpuAnimation;
+				animationCommands.push_back(command::bind_descriptors(mAnimationPipeline->layout(), mDescriptorCache->get_or_create_descriptor_sets({
+					descriptor_binding(0, 0, gpuAnimation.mNodes),
+					descriptor_binding(0, 1, gpuAnimation.mLevelOffsets),
+					descriptor_binding(0, 2, gpuAnimation.mKeyTimes),
+					descriptor_binding(0, 3, gpuAnimation.mKeyValues),
+					descriptor_binding(0, 4, gpuAnimation.mBones),
+					descriptor_binding(0, 5, gpuAnimation.mGlobalTransforms),
+					descriptor_binding(0, 6, mAnimationTimesBuffers[inFlightIndex][animModel.mBoneMatricesBufferIndex]),
+					descriptor_binding(0, 7, mBoneMatricesBuffersAni[inFlightIndex][animModel.mBoneMatricesBufferIndex])
+				})));
+				animationCommands.push_back(command::push_constants(mAnimationPipeline->layout(), gpuAnimation.push_constants(animModel.mClip, 1)));
+				animationCommands.push_back(command::dispatch(1, 1, 1));
+			}
+			animationCommands.push_back(sync::global_memory_barrier(stage::compute_shader >> stage::mesh_shader, access::shader_write >> access::shader_read));
+		}
+		else {
+			// Upload the updated bone matrices into the buffer for the current frame (considering that we have cConcurrentFrames-many concurrent frames):
+			for (const auto& model : mAnimatedModels) {
+				animationCommands.push_back(mBoneMatricesBuffersAni[inFlightIndex][std::get<animated_model_data>(model).mBoneMatricesBufferIndex]->fill(std::get<additional_animated_model_data>(model).mBoneMatricesAni.data(), 0));
+			}
+		}
+
 		auto& pipeline = mUseNvPipeline.value_or(false) ? mPipelineNv : mPipelineExt;
 		context().record(command::gather(
 			    mPipelineStatsPool->reset(inFlightIndex, 1),
@@ -612,10 +708,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 			    mTimestampPool->reset(firstQueryIndex, 2),     // reset the two values relevant for the current frame in flight
 			    mTimestampPool->write_timestamp(firstQueryIndex + 0, stage::all_commands), // measure before drawMeshTasks*
 
-				// Upload the updated bone matrices into the buffer for the current frame (considering that we have cConcurrentFrames-many concurrent frames):
-				command::one_for_each(mAnimatedModels, [this, inFlightIndex](const std::tuple<animated_model_data, additional_animated_model_data>& tpl){
-					return mBoneMatricesBuffersAni[inFlightIndex][std::get<animated_model_data>(tpl).mBoneMatricesBufferIndex]->fill(std::get<additional_animated_model_data>(tpl).mBoneMatricesAni.data(), 0);
-				}),
+				animationCommands,
 
 				command::render_pass(pipeline->renderpass_reference(), context().main_window()->current_backbuffer_reference(), {
 					command::bind_pipeline(pipeline.as_reference()),
@@ -672,6 +765,8 @@ private: // v== Member variables ==v
 	avk::buffer mMaterialBuffer;
 	avk::buffer mMeshletsBuffer;
 	std::array<std::vector<avk::buffer>, cConcurrentFrames> mBoneMatricesBuffersAni;
+	std::array<std::vector<avk::buffer>, cConcurrentFrames> mAnimationTimesBuffers;
+	avk::compute_pipeline mAnimationPipeline;
 	std::vector<avk::image_sampler> mImageSamplers;
 
 	std::vector<data_for_draw_call> mDrawCalls;
@@ -698,6 +793,7 @@ private: // v== Member variables ==v
 	int  mShowMeshletsFrom  = 0;
 	int  mShowMeshletsTo    = 0;
 	std::optional<bool> mUseNvPipeline = {};
+	bool mAnimateOnGpu = false;
 
 	avk::query_pool mTimestampPool;
 	uint64_t mLastTimestamp = 0;
@@ -0,0 +1,282 @@
+#include "meshlet_helpers.hpp"
+#include "model.hpp"
+
+// Headless benchmark which compares meshlet dividers w.r.t. the quality of the meshlets they generate and the time they
+// take. It does not create a Vulkan context, i.e. it can run on machines without a GPU, e.g. in CI.
+// Usage: meshlet_benchmark [options] [model files...]
+//   --output <file>        Write the JSON report to the given file instead of to stdout
+//   --max-vertices <n>     The maximum number of vertices per meshlet (default: 64)
+//   --max-indices <n>      The maximum number of indices per meshlet (default: 378)
+//   --repetitions <n>      How often each divider is run per model; build times are reported as min and median (default: 5)
+//   --separate-meshes      Divide each mesh separately instead of combining the submeshes of a model
+// If no model files are given, the default models which are passed via MESHLET_BENCHMARK_DEFAULT_MODELS (separated by '|') are used.
+
+namespace
+{
+	/** Number of viewpoints around a model which the normal cone culling effectiveness is averaged over */
+	constexpr uint32_t sNumCullingViewpoints = 64;
+
+	struct options
+	{
+		std::optional<std::string> mOutputFile;
+		uint32_t mMaxVertices = 64;
+		uint32_t mMaxIndices = 378;
+		uint32_t mRepetitions = 5;
+		bool mCombineSubmeshes = true;
+		std::vector<std::string> mModelFiles;
+	};
+
+	/** A meshlet divider under test, which divides the given selection into meshlets */
+	struct divider
+	{
+		std::string mName;
+		std::function<std::vector<avk::meshlet>(std::vector<std::tuple<avk::model, std::vector<avk::mesh_index_t>>>&, bool, uint32_t, uint32_t)> mDivide;
+	};
+
+	std::vector<divider> all_dividers()
+	{
+		return {
+			divider{ "basic", [](auto& aSelection, bool aCombine, uint32_t aMaxVertices, uint32_t aMaxIndices) {
+				return avk::divide_into_meshlets(aSelection, avk::basic_meshlets_divider, aCombine, aMaxVertices, aMaxIndices);
+			}},
+			divider{ "locality", [](auto& aSelection, bool aCombine, uint32_t aMaxVertices, uint32_t aMaxIndices) {
+				return avk::divide_into_meshlets(aSelection, avk::locality_meshlets_divider, aCombine, aMaxVertices, aMaxIndices);
+			}}
+		};
+	}
+
+	uint32_t parse_number(int aArgc, char** aArgv, int& aIndex)
+	{
+		if (aIndex + 1 >= aArgc) {
+			throw avk::runtime_error(fmt::format("Missing value for argument '{}'", aArgv[aIndex]));
+		}
+		++aIndex;
+		return static_cast<uint32_t>(std::stoul(aArgv[aIndex]));
+	}
+
+	options parse_options(int aArgc, char** aArgv)
+	{
+		options result;
+		for (int i = 1; i < aArgc; ++i) {
+			const std::string arg = aArgv[i];
+			if (arg == "--output") {
+				if (i + 1 >= aArgc) {
+					throw avk::runtime_error("Missing value for argument '--output'");
+				}
+				result.mOutputFile = aArgv[++i];
+			}
+			else if (arg == "--max-vertices") {
+				result.mMaxVertices = parse_number(aArgc, aArgv, i);
+			}
+			else if (arg == "--max-indices") {
+				result.mMaxIndices = parse_number(aArgc, aArgv, i);
+			}
+			else if (arg == "--repetitions") {
+				result.mRepetitions = std::max(1u, parse_number(aArgc, aArgv, i));
+			}
+			else if (arg == "--separate-meshes") {
+				result.mCombineSubmeshes = false;
+			}
+			else if (arg.starts_with("--")) {
+				throw avk::runtime_error(fmt::format("Unknown argument '{}'", arg));
+			}
+			else {
+				result.mModelFiles.push_back(arg);
+			}
+		}
+#if defined(MESHLET_BENCHMARK_DEFAULT_MODELS)
+		if (result.mModelFiles.empty()) {
+			std::istringstream defaults(MESHLET_BENCHMARK_DEFAULT_MODELS);
+			for (std::string path; std::getline(defaults, path, '|');) {
+				result.mModelFiles.push_back(path);
+			}
+		}
+#endif
+		if (result.mModelFiles.empty()) {
+			throw avk::runtime_error("No model files given.");
+		}
+		return result;
+	}
+
+	/** Gets the positions which the meshlets' vertex indices refer to, i.e. the same positions which divide_into_meshlets passes to the divider. */
+	std::vector<glm::vec3> positions_for(const avk::model_t& aModel, std::optional<avk::mesh_index_t> aMeshIndex)
+	{
+		if (aMeshIndex.has_value()) {
+			return aModel.positions_for_mesh(aMeshIndex.value());
+		}
+		return std::get<0>(avk::get_vertices_and_indices(avk::make_model_references_and_mesh_indices_selection(aModel, aModel.select_all_meshes())));
+	}
+
+	/** Approximate number of bytes which the generated meshlets occupy in CPU memory */
+	size_t cpu_size_of(const std::vector<avk::meshlet>& aMeshlets)
+	{
+		size_t bytes = aMeshlets.capacity() * sizeof(avk::meshlet);
+		for (const auto& m : aMeshlets) {
+			bytes += m.mVertices.capacity() * sizeof(uint32_t) + m.mIndices.capacity() * sizeof(uint8_t);
+		}
+		return bytes;
+	}
+
+	/** Number of bytes which the meshlets occupy in the given GPU format, including the meshlet data array.
+	 *	The meshlets are converted as they have been generated with the configured limits. */
+	template <typename T>
+	size_t gpu_size_of(const std::vector<avk::meshlet>& aMeshlets)
+	{
+		auto [gpuMeshlets, gpuData] = avk::convert_for_gpu_usage<T>(aMeshlets);
+		return gpuMeshlets.size() * sizeof(T) + (gpuData.has_value() ? gpuData->size() * sizeof(uint32_t) : 0);
+	}
+
+	/** Evaluates the given meshlets of a single model and returns the report entry for them. */
+	nlohmann::json evaluate(const std::vector<avk::meshlet>& aMeshlets, const options& aOptions)
+	{
+		const auto stats = avk::analyze_meshlets(aMeshlets);
+		const auto maxTriangles = aOptions.mMaxIndices / 3;
+
+		// Bounds of the whole model, which the culling viewpoints are placed around:
+		avk::bounding_sphere modelBounds;
+		for (const auto& m : aMeshlets) {
+			modelBounds = avk::merge(modelBounds, m.mBoundingSphere);
+		}
+
+		// Tightness of a meshlet's bounding sphere: Radius of a disc with the meshlet's surface area divided by the sphere's
+		// radius. This is 1 for a flat, round meshlet and decreases for elongated, scattered, or strongly curved ones.
+		std::map<std::optional<avk::mesh_index_t>, std::vector<glm::vec3>> positionsPerMesh;
+		double tightnessSum = 0.0;
+		double relativeRadiusSum = 0.0;
+		size_t numTightnessSamples = 0;
+		for (const auto& m : aMeshlets) {
+			auto it = positionsPerMesh.find(m.mMeshIndex);
+			if (it == positionsPerMesh.end()) {
+				it = positionsPerMesh.emplace(m.mMeshIndex, positions_for(m.mModel.get(), m.mMeshIndex)).first;
+			}
+			const auto& positions = it->second;
+			double area = 0.0;
+			for (uint32_t i = 0; i + 2 < m.mIndexCount; i += 3) {
+				const auto& p0 = positions[m.mVertices[m.mIndices[i]]];
+				const auto& p1 = positions[m.mVertices[m.mIndices[i + 1]]];
+				const auto& p2 = positions[m.mVertices[m.mIndices[i + 2]]];
+				area += 0.5 * glm::length(glm::cross(p1 - p0, p2 - p0));
+			}
+			if (m.mBoundingSphere.mRadius > 0.0f) {
+				tightnessSum += std::min(1.0, std::sqrt(area / glm::pi<double>()) / m.mBoundingSphere.mRadius);
+				relativeRadiusSum += modelBounds.mRadius > 0.0f ? m.mBoundingSphere.mRadius / modelBounds.mRadius : 0.0f;
+				++numTightnessSamples;
+			}
+		}
+
+		// Normal cone culling from viewpoints which are evenly distributed on a sphere around the model (Fibonacci sphere):
+		size_t numConesUsable = 0;
+		for (const auto& m : aMeshlets) {
+			numConesUsable += m.mNormalCone.degenerate() ? 0 : 1;
+		}
+		double culledMeshlets = 0.0;
+		double culledTriangles = 0.0;
+		const float goldenAngle = glm::pi<float>() * (3.0f - std::sqrt(5.0f));
+		for (uint32_t v = 0; v < sNumCullingViewpoints; ++v) {
+			const auto y = 1.0f - 2.0f * (static_cast<float>(v) + 0.5f) / static_cast<float>(sNumCullingViewpoints);
+			const auto r = std::sqrt(1.0f - y * y);
+			const auto phi = goldenAngle * static_cast<float>(v);
+			const auto viewpoint = modelBounds.mCenter + 2.0f * modelBounds.mRadius * glm::vec3{ r * std::cos(phi), y, r * std::sin(phi) };
+			for (const auto& m : aMeshlets) {
+				const auto& cone = m.mNormalCone;
+				if (!cone.degenerate() && glm::dot(glm::normalize(cone.mApex - viewpoint), cone.mAxis) >= cone.mCutoff) {
+					culledMeshlets += 1.0;
+					culledTriangles += m.mIndexCount / 3;
+				}
+			}
+		}
+
+		const auto perMeshlet = [&](double aValue) { return aMeshlets.empty() ? 0.0 : aValue / static_cast<double>(aMeshlets.size()); };
+		const auto perTriangle = [&](double aValue) { return stats.mNumTriangles == 0 ? 0.0 : aValue / static_cast<double>(stats.mNumTriangles); };
+
+		nlohmann::json result;
+		result["triangles"] = stats.mNumTriangles;
+		result["meshlets"] = stats.mNumMeshlets;
+		result["meshlets_per_triangle"] = perTriangle(static_cast<double>(stats.mNumMeshlets));
+		result["average_vertex_fill"] = stats.mAverageVerticesPerMeshlet / static_cast<float>(aOptions.mMaxVertices);
+		result["average_primitive_fill"] = maxTriangles == 0 ? 0.0f : stats.mAverageTrianglesPerMeshlet / static_cast<float>(maxTriangles);
+		result["vertices_per_triangle"] = stats.mVerticesPerTriangle;
+		result["vertex_duplication"] = stats.mVertexDuplication;
+		result["bounding_sphere_tightness"] = numTightnessSamples == 0 ? 0.0 : tightnessSum / static_cast<double>(numTightnessSamples);
+		result["bounding_sphere_radius_relative_to_model"] = numTightnessSamples == 0 ? 0.0 : relativeRadiusSum / static_cast<double>(numTightnessSamples);
+		result["cone_culling"] = {
+			{ "usable_cone_fraction", perMeshlet(static_cast<double>(numConesUsable)) },
+			{ "culled_meshlet_fraction", perMeshlet(culledMeshlets / sNumCullingViewpoints) },
+			{ "culled_triangle_fraction", perTriangle(culledTriangles / sNumCullingViewpoints) }
+		};
+		// Sizes of the generated meshlets, i.e. not the memory which is used while dividing into meshlets:
+		result["output_size_bytes"] = {
+			{ "cpu", cpu_size_of(aMeshlets) },
+			{ "gpu_redirected", gpu_size_of<avk::meshlet_redirected_gpu_data>(aMeshlets) },
+			{ "gpu_compact", gpu_size_of<avk::meshlet_compact_gpu_data>(aMeshlets) },
+			{ "gpu_culling", aMeshlets.size() * sizeof(avk::meshlet_culling_gpu_data) }
+		};
+		return result;
+	}
+}
+
+int main(int argc, char** argv) // <== Starting point ==
+{
+	int result = EXIT_FAILURE;
+	try {
+		const auto opts = parse_options(argc, argv);
+
+		nlohmann::json report;
+		report["config"] = {
+			{ "max_vertices", opts.mMaxVertices },
+			{ "max_indices", opts.mMaxIndices },
+			{ "repetitions", opts.mRepetitions },
+			{ "combine_submeshes", opts.mCombineSubmeshes },
+			{ "threads", avk::thread_pool::shared().num_threads() }
+		};
+		report["results"] = nlohmann::json::array();
+
+		for (const auto& file : opts.mModelFiles) {
+			auto model = avk::model_t::load_from_file(file, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_PreTransformVertices);
+			model.enable_shared_ownership();
+			auto allMeshes = model->select_all_meshes();
+
+			for (const auto& div : all_dividers()) {
+				fmt::print(stderr, "Dividing '{}' with the {} divider...\n", file, div.mName);
+				std::vector<double> timesMs;
+				std::vector<avk::meshlet> meshlets;
+				for (uint32_t rep = 0; rep < opts.mRepetitions; ++rep) {
+					auto selection = avk::make_models_and_mesh_indices_selection(model, allMeshes);
+					const auto start = std::chrono::steady_clock::now();
+					meshlets = div.mDivide(selection, opts.mCombineSubmeshes, opts.mMaxVertices, opts.mMaxIndices);
+					const auto end = std::chrono::steady_clock::now();
+					timesMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+				}
+				std::ranges::sort(timesMs);
+
+				auto entry = evaluate(meshlets, opts);
+				entry["model"] = file;
+				entry["divider"] = div.mName;
+				entry["build_time_ms"] = {
+					{ "min", timesMs.front() },
+					{ "median", timesMs[timesMs.size() / 2] }
+				};
+				report["results"].push_back(std::move(entry));
+			}
+		}
+
+		const auto json = report.dump(4);
+		if (opts.mOutputFile.has_value()) {
+			std::ofstream out(opts.mOutputFile.value());
+			if (!out) {
+				throw avk::runtime_error(fmt::format("Unable to open '{}' for writing", opts.mOutputFile.value()));
+			}
+			out << json << '\n';
+		}
+		else {
+			fmt::print("{}\n", json);
+		}
+
+		result = EXIT_SUCCESS;
+	}
+	catch (std::exception& e) {
+		// avk::logic_error and avk::runtime_error end up here, too
+		fmt::print(stderr, "{}\n", e.what());
+	}
+	return result;
+}